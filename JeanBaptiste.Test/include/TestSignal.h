@@ -0,0 +1,62 @@
+#pragma once
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace Utilities
+{
+
+/** Creates the complex test signal shared by the fixtures comparing algorithms with each other: non periodic sines
+    in the real and the imaginary part, so that all bins of a spectrum are occupied.
+    \param[in] sampleCnt ... The count of samples.
+    \return std::vector ... The signal.
+*/
+inline std::vector<std::complex<double>> createSines(const std::size_t sampleCnt)
+{
+    BOOST_TEST_MESSAGE("Setup fixture: sines of " << sampleCnt << " samples.");
+
+    std::vector<std::complex<double>> signal(sampleCnt);
+
+    for (std::size_t i = 0; i < signal.size(); ++i)
+        signal[i] = std::complex<double>(std::sin(0.3 * i) + 0.5 * std::cos(1.1 * i), 0.25 * std::sin(2.1 * i));
+
+    return signal;
+}
+
+/** Calculates the DFT of a signal directly from its definition in long double precision. It is independent of all FFT
+    algorithms and serves as their reference.
+    \param[in] signal ... The signal of N samples.
+    \param[in] directionFactor ... The sign of the exponent as used by the cores (forward: 1, backward: -1).
+    \param[in] scale ... The factor applied on each bin, e.g. 1/N for Normalization_Division_By_Length.
+    \return std::vector ... The N bins.
+*/
+inline std::vector<std::complex<double>> calculateDft(const std::vector<std::complex<double>>& signal,
+    const int directionFactor, const double scale = 1.0)
+{
+    const std::size_t sampleCnt = signal.size();
+    const long double pi = 3.141592653589793238462643383279502884L;
+
+    // Each product of k and n selects one of N twiddle factors.
+    std::vector<std::complex<long double>> twiddles(sampleCnt);
+    for (std::size_t m = 0; m < sampleCnt; ++m)
+        twiddles[m] = std::polar(1.0L, directionFactor * 2.0L * pi * m / sampleCnt);
+
+    std::vector<std::complex<double>> spectrum(sampleCnt);
+
+    for (std::size_t k = 0; k < sampleCnt; ++k)
+    {
+        std::complex<long double> sum = 0;
+
+        for (std::size_t n = 0; n < sampleCnt; ++n)
+            sum += twiddles[(k * n) % sampleCnt] * std::complex<long double>(signal[n]);
+
+        spectrum[k] = std::complex<double>(sum * static_cast<long double>(scale));
+    }
+
+    return spectrum;
+}
+
+}
@@ -0,0 +1,113 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../include/TestSignal.h"
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class AlgorithmDispatchFixture
+{
+protected:
+    static constexpr std::size_t kBegin_ = 1;
+    static constexpr std::size_t kEnd_ = 9;
+
+    using FactoryType = jb::AlgorithmFactory<kBegin_, kEnd_, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward,
+        jbo::Window_vonHann, jbo::Normalization_Division_By_Length, std::complex<double>>;
+
+    FactoryType factory_;
+    std::vector<std::complex<double>> signal_;
+
+public:
+    AlgorithmDispatchFixture()
+        : signal_(Utilities::createSines(1 << (kEnd_ - 1)))
+    {}
+
+    ~AlgorithmDispatchFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(AlgorithmDispatchTestSuite, AlgorithmDispatchFixture)
+
+    BOOST_AUTO_TEST_CASE(algorithm_dispatch_shared_instances)
+    {
+        BOOST_TEST_MESSAGE("Checking that each stage returns the same preconstructed instance.");
+
+        for (std::size_t stage = kBegin_; stage < kEnd_; ++stage)
+        {
+            const auto& algorithm = factory_.getAlgorithmInstance(stage);
+
+            BOOST_TEST(&algorithm == &factory_.getAlgorithmInstance(stage));
+            BOOST_TEST(&algorithm == &FactoryType().getAlgorithmInstance(stage));
+            BOOST_TEST(algorithm.numberOfSamples() == (std::size_t{1} << stage));
+            if (stage > kBegin_)
+                BOOST_TEST(&algorithm != &factory_.getAlgorithmInstance(stage - 1));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(algorithm_dispatch_matches_created_algorithms)
+    {
+        BOOST_TEST_MESSAGE("Comparing preconstructed instances with created algorithms.");
+
+        for (std::size_t stage = kBegin_; stage < kEnd_; ++stage)
+        {
+            const auto& instance = factory_.getAlgorithmInstance(stage);
+            auto created = factory_.getAlgorithm(stage);
+            BOOST_TEST(created->numberOfSamples() == instance.numberOfSamples());
+
+            std::vector<std::complex<double>> expected(signal_.begin(), signal_.begin() + created->numberOfSamples());
+            std::vector<std::complex<double>> data(expected);
+
+            (*created)(&expected[0]);
+            instance(&data[0]);
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+                BOOST_TEST(data[i] == expected[i]);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(algorithm_dispatch_variant)
+    {
+        BOOST_TEST_MESSAGE("Comparing algorithms held by a variant with created algorithms.");
+
+        for (std::size_t stage = kBegin_; stage < kEnd_; ++stage)
+        {
+            auto variant = factory_.getAlgorithmVariant(stage);
+            auto created = factory_.getAlgorithm(stage);
+            BOOST_TEST(variant.index() == stage - kBegin_);
+
+            std::vector<std::complex<double>> expected(signal_.begin(), signal_.begin() + created->numberOfSamples());
+            std::vector<std::complex<double>> data(expected);
+
+            (*created)(&expected[0]);
+            FactoryType::execute(variant, &data[0]);
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+                BOOST_TEST(data[i] == expected[i]);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(algorithm_dispatch_typed_instance)
+    {
+        BOOST_TEST_MESSAGE("Comparing the typed instance of a stage known at compilation time with the created algorithm.");
+
+        constexpr std::size_t kStage = 6;
+        const FactoryType::AlgorithmOfStage<kStage>& typed = factory_.getAlgorithmInstance<kStage>();
+        BOOST_TEST(&typed == &factory_.getAlgorithmInstance(kStage));
+        BOOST_TEST(typed.numberOfSamples() == (std::size_t{1} << kStage));
+
+        std::vector<std::complex<double>> expected(signal_.begin(), signal_.begin() + typed.numberOfSamples());
+        std::vector<std::complex<double>> data(expected);
+
+        (*factory_.getAlgorithm(kStage))(&expected[0]);
+        typed(&data[0]);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+            BOOST_TEST(data[i] == expected[i]);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
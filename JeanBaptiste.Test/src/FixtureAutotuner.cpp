@@ -0,0 +1,164 @@
+#include "../../JeanBaptiste/include/Autotuner.h"
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <fstream>
+#include <string>
+#include "../include/TestSignal.h"
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace fs = boost::filesystem;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class AutotunerFixture
+{
+protected:
+    using TunerType = jb::Autotuner<1, 7, std::complex<double>>;
+
+    std::string wisdomPath_;
+    std::vector<std::complex<double>> signal_;
+
+public:
+    AutotunerFixture()
+        : wisdomPath_((fs::temp_directory_path() / fs::unique_path("jeanbaptiste-wisdom-%%%%-%%%%")).string())
+        , signal_(Utilities::createSines(1 << 6))
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: a temporary wisdom file.");
+    }
+
+    ~AutotunerFixture()
+    {
+        fs::remove(wisdomPath_);
+    }
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(AutotunerTestSuite, AutotunerFixture)
+
+    BOOST_AUTO_TEST_CASE(autotuner_results)
+    {
+        BOOST_TEST_MESSAGE("Comparing plans of the tuned variants with radix 2 plans of the same options.");
+
+        TunerType tuner;
+        jb::PlanFactory<1, 7, jbo::Radix_2, jbo::Decimation_In_Time, std::complex<double>> factory;
+
+        for (std::size_t stage = 1; stage < 7; ++stage)
+        {
+            BOOST_TEST(!tuner.hasWisdom(stage));
+            auto variant = tuner.tune(stage);
+            BOOST_TEST(tuner.hasWisdom(stage));
+            BOOST_TEST((variant.radix != jbo::RadixKind::Radix_4 || stage % 2 == 0));
+
+            bool fallback = true;
+            auto plan = tuner.getAlgorithm(stage, jbo::WindowKind::vonHann, jbo::NormalizationKind::Division_By_Length,
+                jbo::DirectionKind::Backward, &fallback);
+            auto expectedPlan = factory.getAlgorithm(stage, jbo::WindowKind::vonHann,
+                jbo::NormalizationKind::Division_By_Length, jbo::DirectionKind::Backward);
+            BOOST_TEST(!fallback);
+            BOOST_TEST(plan->numberOfSamples() == (std::size_t{1} << stage));
+
+            std::vector<std::complex<double>> expected(signal_.begin(), signal_.begin() + plan->numberOfSamples());
+            std::vector<std::complex<double>> data(expected);
+            std::vector<std::complex<double>> instanceData(expected);
+
+            (*expectedPlan)(&expected[0]);
+            (*plan)(&data[0]);
+            tuner.getAlgorithmInstance(stage, jbo::WindowKind::vonHann, jbo::NormalizationKind::Division_By_Length,
+                jbo::DirectionKind::Backward)(&instanceData[0]);
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+            {
+                BOOST_TEST(std::abs(data[i] - expected[i]) < 0.000000001);
+                BOOST_TEST(instanceData[i] == data[i]);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(autotuner_wisdom_file)
+    {
+        BOOST_TEST_MESSAGE("Checking that measured variants are stored in and restored from the wisdom file.");
+
+        std::vector<TunerType::Variant> variants;
+        {
+            TunerType tuner(wisdomPath_);
+
+            for (std::size_t stage = 1; stage < 7; ++stage)
+            {
+                variants.push_back(tuner.tune(stage));
+                BOOST_TEST(tuner.isWisdomSaved());
+            }
+        }
+
+        BOOST_TEST(fs::exists(wisdomPath_));
+
+        TunerType restoredTuner(wisdomPath_);
+
+        for (std::size_t stage = 1; stage < 7; ++stage)
+        {
+            BOOST_TEST(restoredTuner.hasWisdom(stage));
+            auto variant = restoredTuner.tune(stage);
+            BOOST_TEST((variant.radix == variants[stage - 1].radix));
+            BOOST_TEST((variant.decimation == variants[stage - 1].decimation));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(autotuner_given_wisdom)
+    {
+        BOOST_TEST_MESSAGE("Checking that given wisdom is used without measurement and that foreign entries are kept.");
+
+        {
+            std::ofstream file(wisdomPath_);
+            file << "# stage, value size, radix, decimation\n"
+                 << "4 8 1 1\n"
+                 << "4 4 2 0\n"
+                 // Radix 4 is no variant of an odd stage, so the stage is measured.
+                 << "5 8 1 0\n";
+        }
+
+        TunerType tuner(wisdomPath_);
+        auto variant = tuner.tune(4);
+        BOOST_TEST((variant.radix == jbo::RadixKind::Radix_4));
+        BOOST_TEST((variant.decimation == jbo::DecimationKind::In_Frequency));
+        BOOST_TEST(!tuner.hasWisdom(5));
+        BOOST_TEST((tuner.tune(5).radix != jbo::RadixKind::Radix_4));
+        BOOST_TEST(tuner.hasWisdom(5));
+
+        jb::Autotuner<1, 7, std::complex<float>> floatTuner(wisdomPath_);
+        BOOST_TEST(floatTuner.hasWisdom(4));
+        BOOST_TEST((floatTuner.tune(4).radix == jbo::RadixKind::Radix_Split_2_4));
+        BOOST_TEST(!floatTuner.hasWisdom(5));
+    }
+
+    BOOST_AUTO_TEST_CASE(autotuner_unwritable_wisdom_file)
+    {
+        BOOST_TEST_MESSAGE("Checking that a failed write of the wisdom file is reported and the wisdom is kept in memory.");
+
+        // The wisdom path is no directory, so no file can be created below it.
+        TunerType tuner(wisdomPath_ + "/wisdom");
+        BOOST_TEST(tuner.isWisdomSaved());
+
+        auto variant = tuner.tune(3);
+        BOOST_TEST(!tuner.isWisdomSaved());
+        BOOST_TEST(tuner.hasWisdom(3));
+        BOOST_TEST((tuner.tune(3).radix == variant.radix));
+        BOOST_TEST((tuner.tune(3).decimation == variant.decimation));
+    }
+
+    BOOST_AUTO_TEST_CASE(autotuner_fallback)
+    {
+        BOOST_TEST_MESSAGE("Checking that stages outside of the compiled range are not tuned but fall back.");
+
+        TunerType tuner;
+        bool fallback = false;
+        auto plan = tuner.getAlgorithm(9, jbo::WindowKind::None, jbo::NormalizationKind::No, jbo::DirectionKind::Forward,
+            &fallback);
+
+        BOOST_TEST(fallback);
+        BOOST_TEST(plan->numberOfSamples() == 512);
+        BOOST_TEST(!tuner.hasWisdom(9));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -83,4 +83,26 @@ BOOST_FIXTURE_TEST_SUITE(BitReversalTestSuite, BitReversalFixture)
         createAndCheckWorkData<IndexCount::value>(&LookupTable8Bit[0]);
     }
 
+    BOOST_AUTO_TEST_CASE(reverse_on_10_bit_base)
+    {
+        BOOST_TEST_MESSAGE("Running bit reversal based on 10 bit indices, which exceed the low byte.");
+
+        constexpr std::size_t kBitCnt = 10;
+        std::array<std::complex<double>, 1 << kBitCnt> complexData;
+        for (std::size_t i = 0; i < complexData.size(); ++i)
+            complexData[i].real(i);
+
+        constexpr jbb::BitReversalIndexSwapping<std::integral_constant<int, 1 << kBitCnt>, std::complex<double>> reversal;
+        reversal(&complexData[0]);
+
+        for (std::size_t i = 0; i < complexData.size(); ++i)
+        {
+            std::size_t reverseIndex = 0;
+            for (std::size_t bit = 0; bit < kBitCnt; ++bit)
+                reverseIndex |= ((i >> bit) & 1) << (kBitCnt - 1 - bit);
+
+            BOOST_TEST(static_cast<std::size_t>(complexData[i].real()) == reverseIndex);
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
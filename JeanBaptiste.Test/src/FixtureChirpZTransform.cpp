@@ -0,0 +1,123 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <boost/math/constants/constants.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include "../../JeanBaptiste/include/transforms/ChirpZTransform.h"
+#include <string>
+#include <vector>
+
+namespace constants = boost::math::constants;
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+namespace jbt = jeanbaptiste::transforms;
+
+class ChirpZTransformFixture
+{
+protected:
+    static constexpr unsigned kSampleCnt_ = 100;
+    const double kSamplingRate_ = 1000.0;
+    const double kPrecision_ = 0.000000001;
+
+    std::vector<std::complex<double>> signal_;
+
+public:
+    ChirpZTransformFixture()
+        : signal_(kSampleCnt_)
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: two close complex sines of 100 samples.");
+
+        for (std::size_t n = 0; n < signal_.size(); ++n)
+            signal_[n] = std::polar(1.0, constants::two_pi<double>() * 101.0 * n / kSamplingRate_)
+                + std::polar(0.5, constants::two_pi<double>() * 104.5 * n / kSamplingRate_ + 0.3);
+    }
+
+    ~ChirpZTransformFixture()
+    {}
+
+    /** Evaluates the spectrum at the given frequency directly.
+    */
+    std::complex<double> calculateExpectedBin(const double frequency, const double directionFactor) const
+    {
+        std::complex<double> sum;
+        for (std::size_t n = 0; n < signal_.size(); ++n)
+            sum += signal_[n] * std::polar(1.0, directionFactor * constants::two_pi<double>() * frequency * n / kSamplingRate_);
+
+        return sum;
+    }
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(ChirpZTransformTestSuite, ChirpZTransformFixture)
+
+    BOOST_AUTO_TEST_CASE(zoom_into_band)
+    {
+        BOOST_TEST_MESSAGE("Zooming into [95 Hz, 110 Hz] with 61 bins.");
+
+        jbt::ChirpZTransform<1, 10, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Backward, std::complex<double>>
+            forward(kSampleCnt_, 61, 95.0, 110.0, kSamplingRate_);
+        jbt::ChirpZTransform<1, 10, jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Direction_Forward, std::complex<double>>
+            backward(kSampleCnt_, 61, 95.0, 110.0, kSamplingRate_);
+
+        BOOST_TEST(forward.transformLength() == 256);
+        BOOST_TEST(std::abs(forward.frequency(24) - 101.0) < kPrecision_);
+
+        std::vector<std::complex<double>> bins(forward.binCount());
+        forward(&signal_[0], &bins[0]);
+        for (std::size_t m = 0; m < bins.size(); ++m)
+            BOOST_TEST(std::abs(bins[m] - calculateExpectedBin(forward.frequency(m), -1.0)) < kPrecision_);
+
+        backward(&signal_[0], &bins[0]);
+        for (std::size_t m = 0; m < bins.size(); ++m)
+            BOOST_TEST(std::abs(bins[m] - calculateExpectedBin(backward.frequency(m), 1.0)) < kPrecision_);
+    }
+
+    BOOST_AUTO_TEST_CASE(full_band_equals_fft)
+    {
+        BOOST_TEST_MESSAGE("Comparing a chirp-z transform over all FFT bins with a FFT.");
+
+        constexpr unsigned kStage = 6;
+        constexpr unsigned kLength = 1 << kStage;
+
+        jb::AlgorithmFactory<kStage, kStage + 1, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward,
+            jbo::Window_None, jbo::Normalization_No, std::complex<double>> factory;
+        jbt::ChirpZTransform<1, 5, jbo::Radix_4, jbo::Decimation_In_Time, jbo::Direction_Forward, std::complex<double>>
+            transform(kLength, kLength, 0.0, kLength - 1.0, kLength);
+
+        std::vector<std::complex<double>> expected(signal_.begin(), signal_.begin() + kLength);
+        (*factory.getAlgorithm(kStage))(&expected[0]);
+
+        std::vector<double> realSignal(kLength);
+        for (std::size_t n = 0; n < kLength; ++n)
+            realSignal[n] = signal_[n].real();
+        std::vector<std::complex<double>> realExpected(realSignal.begin(), realSignal.end());
+        (*factory.getAlgorithm(kStage))(&realExpected[0]);
+
+        std::vector<std::complex<double>> bins(kLength);
+        transform(&signal_[0], &bins[0]);
+        for (std::size_t k = 0; k < kLength; ++k)
+            BOOST_TEST(std::abs(bins[k] - expected[k]) < kPrecision_);
+
+        transform(&realSignal[0], &bins[0]);
+        for (std::size_t k = 0; k < kLength; ++k)
+            BOOST_TEST(std::abs(bins[k] - realExpected[k]) < kPrecision_);
+    }
+
+    BOOST_AUTO_TEST_CASE(exceeding_fft_length)
+    {
+        BOOST_TEST_MESSAGE("Checking that a chirp-z transform exceeding the largest FFT length is rejected.");
+
+        using TransformType = jbt::ChirpZTransform<1, 6, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward,
+            std::complex<double>>;
+
+        // 32 samples is the largest FFT length, N + M - 1 = 33 samples are required.
+        BOOST_CHECK_THROW(TransformType(17, 17, 0.0, 0.25), std::length_error);
+
+        TransformType transform(16, 17, 0.0, 0.25);
+        std::vector<std::complex<double>> bins(17);
+        transform(&signal_[0], &bins[0]);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,125 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../include/TestSignal.h"
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class ConjugatedBackwardFixture
+{
+protected:
+    std::vector<std::complex<double>> signal_;
+
+    /** Runs Direction_Backward_Conjugated and Direction_Backward algorithms of the same options on the signal and compares
+        their results.
+    */
+    template <std::size_t Begin, std::size_t End, typename Radix, typename Decimation, typename Window, typename Normalization,
+              typename WindowInput, typename Complex>
+    void compare(const double precision)
+    {
+        jb::AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Backward_Conjugated, Window, Normalization, Complex,
+            WindowInput> conjugatedFactory;
+        jb::AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Backward, Window, Normalization, Complex,
+            WindowInput> factory;
+
+        for (std::size_t stage = Begin; stage < End; ++stage)
+        {
+            auto conjugated = conjugatedFactory.getAlgorithm(stage);
+            auto algorithm = factory.getAlgorithm(stage);
+
+            std::vector<Complex> expected(conjugated->numberOfSamples());
+            for (std::size_t i = 0; i < expected.size(); ++i)
+                expected[i] = Complex(signal_[i]);
+            std::vector<Complex> data(expected);
+
+            (*algorithm)(&expected[0]);
+            (*conjugated)(&data[0]);
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+                BOOST_TEST(std::abs(data[i] - expected[i]) < precision);
+        }
+    }
+
+public:
+    ConjugatedBackwardFixture()
+        : signal_(Utilities::createSines(1 << 8))
+    {}
+
+    ~ConjugatedBackwardFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(ConjugatedBackwardTestSuite, ConjugatedBackwardFixture)
+
+    BOOST_AUTO_TEST_CASE(conjugated_backward_radix2)
+    {
+        BOOST_TEST_MESSAGE("Comparing conjugated radix 2 backward FFTs with backward FFTs.");
+
+        using Complex = std::complex<double>;
+
+        // DIT conjugates in the bit reversal and the normalization, DIF in the window and the bit reversal.
+        compare<1, 9, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Window_None, jbo::Normalization_Division_By_Length,
+            jbo::WindowInput_Real, Complex>(0.000000001);
+        compare<1, 9, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Window_Hamming, jbo::Normalization_No,
+            jbo::WindowInput_Complex, Complex>(0.000000001);
+        compare<1, 9, jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Window_None, jbo::Normalization_Square_Root,
+            jbo::WindowInput_Real, Complex>(0.000000001);
+        compare<1, 9, jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Window_vonHann, jbo::Normalization_No,
+            jbo::WindowInput_Real, Complex>(0.000000001);
+    }
+
+    BOOST_AUTO_TEST_CASE(conjugated_backward_radix4_split_radix)
+    {
+        BOOST_TEST_MESSAGE("Comparing conjugated radix 4 and split radix backward FFTs with backward FFTs.");
+
+        using Complex = std::complex<double>;
+
+        compare<1, 5, jbo::Radix_4, jbo::Decimation_In_Time, jbo::Window_None, jbo::Normalization_Division_By_Length,
+            jbo::WindowInput_Real, Complex>(0.000000001);
+        compare<1, 5, jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Window_None, jbo::Normalization_No,
+            jbo::WindowInput_Real, Complex>(0.000000001);
+        compare<1, 5, jbo::Radix_4, jbo::Decimation_In_Time, jbo::Window_Hamming, jbo::Normalization_No,
+            jbo::WindowInput_Complex, Complex>(0.000000001);
+        compare<1, 5, jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Window_Bartlett, jbo::Normalization_Division_By_Length,
+            jbo::WindowInput_Real, Complex>(0.000000001);
+        compare<1, 9, jbo::Radix_Split_2_4, jbo::Decimation_In_Time, jbo::Window_Blackman, jbo::Normalization_Division_By_Length,
+            jbo::WindowInput_Complex, Complex>(0.000000001);
+        compare<1, 9, jbo::Radix_Split_2_4, jbo::Decimation_In_Frequency, jbo::Window_None, jbo::Normalization_No,
+            jbo::WindowInput_Real, Complex>(0.000000001);
+    }
+
+    BOOST_AUTO_TEST_CASE(conjugated_backward_float)
+    {
+        BOOST_TEST_MESSAGE("Comparing conjugated backward FFTs of float data, whose windows are vectorized.");
+
+        using Complex = std::complex<float>;
+
+        compare<1, 9, jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Window_Welch, jbo::Normalization_Division_By_Length,
+            jbo::WindowInput_Complex, Complex>(0.0001);
+        compare<1, 9, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Window_Bartlett, jbo::Normalization_Division_By_Length,
+            jbo::WindowInput_Real, Complex>(0.0001);
+    }
+
+    BOOST_AUTO_TEST_CASE(conjugated_backward_round_trip)
+    {
+        BOOST_TEST_MESSAGE("Checking that a conjugated backward FFT inverts a forward FFT.");
+
+        jb::AlgorithmFactory<6, 7, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_No, std::complex<double>> forwardFactory;
+        jb::AlgorithmFactory<6, 7, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Backward_Conjugated, jbo::Window_None,
+            jbo::Normalization_Division_By_Length, std::complex<double>> backwardFactory;
+
+        std::vector<std::complex<double>> data(signal_.begin(), signal_.begin() + 64);
+        (*forwardFactory.getAlgorithm(6))(&data[0]);
+        (*backwardFactory.getAlgorithm(6))(&data[0]);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+            BOOST_TEST(std::abs(data[i] - signal_[i]) < 0.000000001);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../../JeanBaptiste/include/streaming/OverlapSaveConvolution.h"
+#include "../../JeanBaptiste/include/streaming/PartitionedConvolution.h"
+#include <string>
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jbo = jeanbaptiste::options;
+namespace jbs = jeanbaptiste::streaming;
+
+class ConvolutionFixture
+{
+protected:
+    static constexpr unsigned kSignalLength_ = 500;
+    static constexpr unsigned kFilterLength_ = 20;
+    const double kPrecision_ = 0.000000001;
+
+    std::vector<double> signal_;
+    std::vector<double> filter_;
+    std::vector<double> expected_;
+
+    /** Pushes the signal through a convolution in blocks of varying size.
+        \return std::vector ... The output samples.
+    */
+    template <typename Convolution>
+    std::vector<double> filter(Convolution& convolution)
+    {
+        std::vector<double> output(signal_.size());
+
+        const std::size_t blockSizes[] = {1, 7, 50, 3, 32, 64, 13};
+        for (std::size_t position = 0, block = 0; position < signal_.size(); ++block)
+        {
+            auto count = std::min(blockSizes[block % 7], signal_.size() - position);
+            convolution(&signal_[position], &output[position], count);
+            position += count;
+        }
+
+        return output;
+    }
+
+    /** Compares output with the directly calculated convolution taking the latency of the convolution into account.
+    */
+    void checkOutput(const std::vector<double>& output, const std::size_t latency)
+    {
+        for (std::size_t i = 0; i < latency; ++i)
+            BOOST_TEST(std::abs(output[i]) < kPrecision_);
+
+        for (auto i = latency; i < output.size(); ++i)
+            BOOST_TEST(std::abs(output[i] - expected_[i - latency]) < kPrecision_);
+    }
+
+public:
+    ConvolutionFixture()
+        : signal_(kSignalLength_),
+          filter_(kFilterLength_),
+          expected_(kSignalLength_)
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: 500 signal samples filtered by a FIR filter of 20 coefficients.");
+
+        for (std::size_t i = 0; i < signal_.size(); ++i)
+            signal_[i] = std::sin(0.05 * i * i) + 0.25 * std::cos(2.1 * i);
+
+        for (std::size_t i = 0; i < filter_.size(); ++i)
+            filter_[i] = std::exp(-0.2 * i) * std::cos(0.7 * i);
+
+        // Direct form convolution.
+        for (std::size_t n = 0; n < signal_.size(); ++n)
+            for (std::size_t k = 0; k < filter_.size() && k <= n; ++k)
+                expected_[n] += filter_[k] * signal_[n - k];
+    }
+
+    ~ConvolutionFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(ConvolutionTestSuite, ConvolutionFixture)
+
+    BOOST_AUTO_TEST_CASE(overlap_save)
+    {
+        BOOST_TEST_MESSAGE("Running overlap-save convolution with a FFT length of 64.");
+
+        jbs::OverlapSaveConvolution<5, 8, jbo::Radix_2, jbo::Decimation_In_Frequency, std::complex<double>>
+            convolution(6, &filter_[0], filter_.size());
+
+        checkOutput(filter(convolution), convolution.blockSize());
+    }
+
+    BOOST_AUTO_TEST_CASE(overlap_save_split_radix)
+    {
+        BOOST_TEST_MESSAGE("Running overlap-save convolution based on split radix FFTs with a FFT length of 32.");
+
+        jbs::OverlapSaveConvolution<5, 8, jbo::Radix_Split_2_4, jbo::Decimation_In_Time, std::complex<double>>
+            convolution(5, &filter_[0], filter_.size());
+
+        checkOutput(filter(convolution), convolution.blockSize());
+    }
+
+    BOOST_AUTO_TEST_CASE(uniformly_partitioned)
+    {
+        BOOST_TEST_MESSAGE("Running uniformly partitioned convolution with a FFT length of 8 (5 partitions).");
+
+        jbs::PartitionedConvolution<3, 6, jbo::Radix_2, jbo::Decimation_In_Time, std::complex<double>>
+            convolution(3, &filter_[0], filter_.size());
+
+        BOOST_TEST(convolution.partitionCount() == 5);
+        checkOutput(filter(convolution), convolution.blockSize());
+    }
+
+    BOOST_AUTO_TEST_CASE(uniformly_partitioned_single_partition)
+    {
+        BOOST_TEST_MESSAGE("Running uniformly partitioned convolution with a FFT length of 64 (1 partition).");
+
+        jbs::PartitionedConvolution<3, 7, jbo::Radix_2, jbo::Decimation_In_Time, std::complex<double>>
+            convolution(6, &filter_[0], filter_.size());
+
+        BOOST_TEST(convolution.partitionCount() == 1);
+        checkOutput(filter(convolution), convolution.blockSize());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
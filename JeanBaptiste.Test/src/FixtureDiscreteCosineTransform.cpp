@@ -0,0 +1,104 @@
+#include <boost/math/constants/constants.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../../JeanBaptiste/include/transforms/DiscreteCosineTransform.h"
+#include <string>
+#include <vector>
+
+namespace constants = boost::math::constants;
+namespace ut = boost::unit_test;
+namespace jbo = jeanbaptiste::options;
+namespace jbt = jeanbaptiste::transforms;
+
+class DiscreteCosineTransformFixture
+{
+protected:
+    static constexpr unsigned kStage_ = 5;
+    static constexpr unsigned kSampleCnt_ = 1 << kStage_;
+    const double kPrecision_ = 0.000000001;
+
+    std::vector<double> signal_;
+
+    /** Calculates a discrete cosine transform by its definition.
+        \param[in] shiftIn ... The shift of the sample index: 1/2 for Dct_II and Dct_IV, 0 for Dct_III.
+        \param[in] shiftOut ... The shift of the coefficient index: 0 for Dct_II, 1/2 for Dct_III and Dct_IV.
+    */
+    std::vector<double> calculateExpectedCoefficients(const double shiftIn, const double shiftOut) const
+    {
+        std::vector<double> coefficients(kSampleCnt_);
+        for (std::size_t k = 0; k < kSampleCnt_; ++k)
+            for (std::size_t n = 0; n < kSampleCnt_; ++n)
+                coefficients[k] += ((n == 0 && shiftIn == 0.0) ? 0.5 : 1.0) * signal_[n]
+                    * std::cos(constants::pi<double>() * (n + shiftIn) * (k + shiftOut) / kSampleCnt_);
+
+        return coefficients;
+    }
+
+public:
+    DiscreteCosineTransformFixture()
+        : signal_(kSampleCnt_)
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: sines and a ramp of 32 samples.");
+
+        for (std::size_t n = 0; n < signal_.size(); ++n)
+            signal_[n] = std::sin(0.7 * n) + 0.5 * std::cos(2.3 * n + 0.2) + 0.01 * n;
+    }
+
+    ~DiscreteCosineTransformFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(DiscreteCosineTransformTestSuite, DiscreteCosineTransformFixture)
+
+    BOOST_AUTO_TEST_CASE(dct_2_3_round_trip)
+    {
+        BOOST_TEST_MESSAGE("Running DCT-II and DCT-III and comparing them with their definition.");
+
+        jbt::DiscreteCosineTransformFactory<2, 8, jbo::Dct_II, jbo::Radix_2, jbo::Decimation_In_Time, std::complex<double>> dct2Factory;
+        jbt::DiscreteCosineTransformFactory<2, 8, jbo::Dct_III, jbo::Radix_Split_2_4, jbo::Decimation_In_Frequency, std::complex<double>> dct3Factory;
+        auto dct2 = dct2Factory.getTransform(kStage_);
+        auto dct3 = dct3Factory.getTransform(kStage_);
+        BOOST_TEST(dct2->numberOfSamples() == kSampleCnt_);
+
+        std::vector<double> coefficients(kSampleCnt_);
+        (*dct2)(&signal_[0], &coefficients[0]);
+        auto expected = calculateExpectedCoefficients(0.5, 0.0);
+        for (std::size_t k = 0; k < kSampleCnt_; ++k)
+            BOOST_TEST(std::abs(coefficients[k] - expected[k]) < kPrecision_);
+
+        // Dct_III of Dct_II returns the samples scaled by N/2.
+        std::vector<double> samples(kSampleCnt_);
+        (*dct3)(&coefficients[0], &samples[0]);
+        for (std::size_t n = 0; n < kSampleCnt_; ++n)
+            BOOST_TEST(std::abs(samples[n] - kSampleCnt_ / 2 * signal_[n]) < kPrecision_);
+
+        // In place.
+        auto data = signal_;
+        (*dct3)(&data[0], &data[0]);
+        expected = calculateExpectedCoefficients(0.0, 0.5);
+        for (std::size_t k = 0; k < kSampleCnt_; ++k)
+            BOOST_TEST(std::abs(data[k] - expected[k]) < kPrecision_);
+    }
+
+    BOOST_AUTO_TEST_CASE(dct_4)
+    {
+        BOOST_TEST_MESSAGE("Running DCT-IV and comparing it with its definition.");
+
+        jbt::DiscreteCosineTransform<jbo::Dct_IV, std::integral_constant<int, kStage_>, jbo::Radix_2, jbo::Decimation_In_Frequency,
+            std::complex<double>> dct4;
+
+        std::vector<double> coefficients(kSampleCnt_);
+        dct4(&signal_[0], &coefficients[0]);
+        auto expected = calculateExpectedCoefficients(0.5, 0.5);
+        for (std::size_t k = 0; k < kSampleCnt_; ++k)
+            BOOST_TEST(std::abs(coefficients[k] - expected[k]) < kPrecision_);
+
+        std::vector<double> samples(kSampleCnt_);
+        dct4(&coefficients[0], &samples[0]);
+        for (std::size_t n = 0; n < kSampleCnt_; ++n)
+            BOOST_TEST(std::abs(samples[n] - kSampleCnt_ / 2 * signal_[n]) < kPrecision_);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include "../../JeanBaptiste/include/FixedPointAlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class FixedPointFftFixture
+{
+protected:
+    std::vector<std::complex<double>> signal_;
+
+    /** Runs a fixed point algorithm on the quantized signal and compares the result scaled by its block exponent with
+        the result of a double precision algorithm on the same quantized samples. The error is relative to full scale
+        of the DFT: sample count.
+    */
+    template <std::size_t Begin, std::size_t End, typename Radix, typename Decimation, typename Direction, typename Complex>
+    void compareFft(const std::vector<std::complex<double>>& signal, const double precision) const
+    {
+        using Integer = typename Complex::value_type;
+
+        jb::FixedPointAlgorithmFactory<Begin, End, Radix, Decimation, Direction, Complex> fixedPointFactory;
+        jb::AlgorithmFactory<Begin, End, Radix, Decimation, Direction, jbo::Window_None, jbo::Normalization_No,
+            std::complex<double>> factory;
+
+        for (auto stage = Begin; stage < End; ++stage)
+        {
+            auto fixedPointAlgorithm = fixedPointFactory.getAlgorithm(stage);
+            auto algorithm = factory.getAlgorithm(stage);
+            BOOST_TEST(fixedPointAlgorithm->numberOfSamples() == algorithm->numberOfSamples());
+
+            std::vector<Complex> data(fixedPointAlgorithm->numberOfSamples());
+            std::vector<std::complex<double>> expected(data.size());
+            for (std::size_t i = 0; i < data.size(); ++i)
+            {
+                data[i] = Complex(jb::basic::toFixedPoint<Integer>(signal[i].real()), jb::basic::toFixedPoint<Integer>(signal[i].imag()));
+                expected[i] = std::complex<double>(jb::basic::toFloatingPoint(data[i].real()), jb::basic::toFloatingPoint(data[i].imag()));
+            }
+
+            auto blockExponent = (*fixedPointAlgorithm)(&data[0]);
+            (*algorithm)(&expected[0]);
+
+            double maximumError = 0;
+            for (std::size_t i = 0; i < data.size(); ++i)
+            {
+                std::complex<double> value(
+                    std::ldexp(jb::basic::toFloatingPoint(data[i].real()), blockExponent),
+                    std::ldexp(jb::basic::toFloatingPoint(data[i].imag()), blockExponent));
+                maximumError = std::max(maximumError, std::abs(value - expected[i]));
+            }
+
+            BOOST_TEST(maximumError / data.size() < precision);
+        }
+    }
+
+public:
+    FixedPointFftFixture()
+        : signal_(1 << 10)
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: sines of 1024 samples near full scale.");
+
+        for (std::size_t i = 0; i < signal_.size(); ++i)
+            signal_[i] = std::complex<double>(0.6 * std::sin(0.3 * i) + 0.39 * std::cos(1.1 * i), 0.7 * std::sin(2.1 * i) - 0.29);
+    }
+
+    ~FixedPointFftFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(FixedPointFftTestSuite, FixedPointFftFixture)
+
+    BOOST_AUTO_TEST_CASE(fixed_point_q15)
+    {
+        BOOST_TEST_MESSAGE("Comparing Q15 FFTs with block floating point scaling against double precision.");
+
+        using Complex = jb::basic::ComplexQ15;
+        const double kPrecision = 0.0005;
+
+        compareFft<2, 11, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, Complex>(signal_, kPrecision);
+        compareFft<2, 11, jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Direction_Forward, Complex>(signal_, kPrecision);
+        compareFft<2, 11, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Backward, Complex>(signal_, kPrecision);
+        compareFft<2, 11, jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Direction_Backward, Complex>(signal_, kPrecision);
+        compareFft<1, 6, jbo::Radix_4, jbo::Decimation_In_Time, jbo::Direction_Forward, Complex>(signal_, kPrecision);
+        compareFft<1, 6, jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Direction_Forward, Complex>(signal_, kPrecision);
+        compareFft<1, 6, jbo::Radix_4, jbo::Decimation_In_Time, jbo::Direction_Backward, Complex>(signal_, kPrecision);
+        compareFft<1, 6, jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Direction_Backward, Complex>(signal_, kPrecision);
+    }
+
+    BOOST_AUTO_TEST_CASE(fixed_point_q31)
+    {
+        BOOST_TEST_MESSAGE("Comparing Q31 FFTs with block floating point scaling against double precision.");
+
+        using Complex = jb::basic::ComplexQ31;
+        const double kPrecision = 0.00000001;
+
+        compareFft<2, 11, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, Complex>(signal_, kPrecision);
+        compareFft<2, 11, jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Direction_Backward, Complex>(signal_, kPrecision);
+        compareFft<1, 6, jbo::Radix_4, jbo::Decimation_In_Time, jbo::Direction_Backward, Complex>(signal_, kPrecision);
+        compareFft<1, 6, jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Direction_Forward, Complex>(signal_, kPrecision);
+    }
+
+    BOOST_AUTO_TEST_CASE(fixed_point_full_scale)
+    {
+        BOOST_TEST_MESSAGE("Transforming a constant of -1 without overflow.");
+
+        std::vector<std::complex<double>> signal(signal_.size(), std::complex<double>(-1.0, -1.0));
+
+        compareFft<10, 11, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jb::basic::ComplexQ15>(signal, 0.0005);
+        compareFft<5, 6, jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Direction_Forward, jb::basic::ComplexQ15>(signal, 0.0005);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include "../../JeanBaptiste/include/BinAlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../../JeanBaptiste/include/core/Goertzel.h"
+#include "../../JeanBaptiste/include/core/SlidingDft.h"
+#include <string>
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbc = jeanbaptiste::core;
+namespace jbo = jeanbaptiste::options;
+
+class GoertzelFixture
+{
+protected:
+    static constexpr unsigned kStage_ = 6;
+    static constexpr unsigned kSampleCnt_ = 1 << kStage_;
+    static constexpr unsigned kSignalLength_ = 1000;
+    // Goertzel accumulates rounding errors over N samples, mostly for bins close to 0 and N.
+    const double kPrecision_ = 0.0000001;
+
+    std::vector<std::complex<double>> signal_;
+
+    /** Calculates the full spectrum of count samples starting at position using a FFT algorithm.
+    */
+    template <typename Direction, typename Window = jbo::Window_None>
+    std::vector<std::complex<double>> calculateSpectrum(const std::size_t position) const
+    {
+        jb::AlgorithmFactory<kStage_, kStage_ + 1, jbo::Radix_2, jbo::Decimation_In_Time, Direction, Window,
+            jbo::Normalization_No, std::complex<double>> factory;
+
+        std::vector<std::complex<double>> spectrum(signal_.begin() + position, signal_.begin() + position + kSampleCnt_);
+        (*factory.getAlgorithm(kStage_))(&spectrum[0]);
+
+        return spectrum;
+    }
+
+public:
+    GoertzelFixture()
+        : signal_(kSignalLength_)
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: complex sines of 1000 samples.");
+
+        for (std::size_t i = 0; i < signal_.size(); ++i)
+            signal_[i] = std::complex<double>(std::sin(0.3 * i) + 0.5 * std::cos(1.7 * i), 0.25 * std::sin(2.9 * i + 0.5));
+    }
+
+    ~GoertzelFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(GoertzelTestSuite, GoertzelFixture)
+
+    BOOST_AUTO_TEST_CASE(goertzel_matches_fft)
+    {
+        BOOST_TEST_MESSAGE("Comparing Goertzel bins with forward and backward FFT output.");
+
+        using SampleCnt = std::integral_constant<int, kSampleCnt_>;
+        jbc::Goertzel<SampleCnt, std::integral_constant<int, 1>, std::complex<double>, 0, 3, 17, 63> forward;
+        jbc::Goertzel<SampleCnt, std::integral_constant<int, -1>, std::complex<double>, 5, 32> backward;
+
+        auto forwardSpectrum = calculateSpectrum<jbo::Direction_Forward>(0);
+        auto backwardSpectrum = calculateSpectrum<jbo::Direction_Backward>(0);
+
+        std::vector<std::complex<double>> data(signal_.begin(), signal_.begin() + kSampleCnt_);
+        forward(&data[0]);
+        for (std::size_t j = 0; j < forward.numberOfBins(); ++j)
+            BOOST_TEST(std::abs(data[forward.bin(j)] - forwardSpectrum[forward.bin(j)]) < kPrecision_);
+
+        std::vector<std::complex<double>> bins(backward.numberOfBins());
+        backward(&signal_[0], &bins[0]);
+        for (std::size_t j = 0; j < backward.numberOfBins(); ++j)
+            BOOST_TEST(std::abs(bins[j] - backwardSpectrum[backward.bin(j)]) < kPrecision_);
+    }
+
+    BOOST_AUTO_TEST_CASE(sliding_dft_tracks_fft)
+    {
+        BOOST_TEST_MESSAGE("Tracking bins with a sliding DFT and comparing them with FFT output of the latest samples.");
+
+        using SampleCnt = std::integral_constant<int, kSampleCnt_>;
+        constexpr int kBins[] = {1, 9, 40};
+
+        // A short resynchronization interval so that the recalculation is hit several times.
+        jbc::SlidingDft<SampleCnt, std::integral_constant<int, 1>, std::complex<double>, 1, 9, 40> tracker(100);
+
+        const std::size_t blockSizes[] = {1, 7, 50, 3, 32, 64, 13};
+        for (std::size_t position = 0, block = 0; position < signal_.size(); ++block)
+        {
+            auto count = std::min(blockSizes[block % 7], signal_.size() - position);
+            tracker.push(&signal_[position], count);
+            position += count;
+
+            if (position < kSampleCnt_)
+                continue;
+
+            auto spectrum = calculateSpectrum<jbo::Direction_Forward>(position - kSampleCnt_);
+            for (std::size_t j = 0; j < tracker.numberOfBins(); ++j)
+                BOOST_TEST(std::abs(tracker.bin(j) - spectrum[kBins[j]]) < kPrecision_);
+        }
+
+        tracker.reset();
+        for (std::size_t j = 0; j < tracker.numberOfBins(); ++j)
+            BOOST_TEST(std::abs(tracker.bin(j)) == 0.0);
+    }
+
+    BOOST_AUTO_TEST_CASE(bin_factory_selection)
+    {
+        BOOST_TEST_MESSAGE("Selecting Goertzel or FFT per stage and comparing the requested bins with FFT output.");
+
+        using Factory = jb::BinAlgorithmFactory<2, 8, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward,
+            jbo::Window_vonHann, jbo::Normalization_No, std::complex<double>, 2, 11, 30>;
+        Factory factory;
+
+        BOOST_TEST(!Factory::prefersGoertzel(3));
+        BOOST_TEST(Factory::prefersGoertzel(kStage_));
+
+        auto spectrum = calculateSpectrum<jbo::Direction_Forward, jbo::Window_vonHann>(0);
+
+        std::vector<std::complex<double>> data(signal_.begin(), signal_.begin() + kSampleCnt_);
+        auto algorithm = factory.getAlgorithm(kStage_);
+        BOOST_TEST(algorithm->numberOfSamples() == kSampleCnt_);
+        (*algorithm)(&data[0]);
+
+        for (int bin : {2, 11, 30})
+            BOOST_TEST(std::abs(data[bin] - spectrum[bin]) < kPrecision_);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
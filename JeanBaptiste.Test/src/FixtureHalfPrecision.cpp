@@ -0,0 +1,155 @@
+#include "../../JeanBaptiste/include/HalfPrecisionAlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include "../include/TestSignal.h"
+#include <type_traits>
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class HalfPrecisionFixture
+{
+protected:
+    std::vector<std::complex<double>> signal_;
+
+    /** Runs an algorithm on 16 bit storage and compares it with the DFT of the same rounded samples.
+    */
+    template <std::size_t Stage, typename Radix, typename Decimation, typename Half>
+    void compareFft(const double precision) const
+    {
+        jb::HalfPrecisionAlgorithmFactory<Stage, Stage + 1, Radix, Decimation, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_Division_By_Length, Half> halfFactory;
+
+        auto halfAlgorithm = halfFactory.getAlgorithm(Stage);
+        const std::size_t sampleCnt = std::is_same_v<Radix, jbo::Radix_4> ? std::size_t{1} << (Stage << 1)
+                                                                           : std::size_t{1} << Stage;
+        BOOST_TEST(halfAlgorithm->numberOfSamples() == sampleCnt);
+
+        std::vector<jb::basic::HalfComplex<Half>> data(sampleCnt);
+        std::vector<std::complex<double>> rounded(sampleCnt);
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = std::complex<float>(signal_[i]);
+            rounded[i] = std::complex<double>(data[i].real(), data[i].imag());
+        }
+
+        (*halfAlgorithm)(&data[0]);
+        auto expected = Utilities::calculateDft(rounded, 1, 1.0 / sampleCnt);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+            BOOST_TEST(std::abs(std::complex<double>(data[i].real(), data[i].imag()) - expected[i]) < precision);
+    }
+
+public:
+    HalfPrecisionFixture()
+        : signal_(Utilities::createSines(1 << 12))
+    {}
+
+    ~HalfPrecisionFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(HalfPrecisionTestSuite, HalfPrecisionFixture)
+
+    BOOST_AUTO_TEST_CASE(half_precision_conversion)
+    {
+        BOOST_TEST_MESSAGE("Converting between float and 16 bit floating point numbers.");
+
+        BOOST_TEST(jb::basic::toFloat16(1.0f).bits == 0x3C00);
+        BOOST_TEST(jb::basic::toFloat16(-2.0f).bits == 0xC000);
+        BOOST_TEST(jb::basic::toFloat16(0.1f).bits == 0x2E66);
+        BOOST_TEST(jb::basic::toFloat16(65504.0f).bits == 0x7BFF);
+        // Rounds up to infinity.
+        BOOST_TEST(jb::basic::toFloat16(65520.0f).bits == 0x7C00);
+        // The smallest subnormal: 2^-24.
+        BOOST_TEST(jb::basic::toFloat16(std::ldexp(1.0f, -24)).bits == 0x0001);
+        // Ties to even: 1 + 2^-11 lies between 1 and 1 + 2^-10.
+        BOOST_TEST(jb::basic::toFloat16(1.0f + std::ldexp(1.0f, -11)).bits == 0x3C00);
+        BOOST_TEST(jb::basic::toBFloat16(1.0f).bits == 0x3F80);
+        BOOST_TEST(jb::basic::toBFloat16(-0.1f).bits == 0xBDCD);
+
+        // All numbers besides NaNs survive a round trip through float.
+        for (std::uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+        {
+            jb::basic::Float16 half{static_cast<std::uint16_t>(bits)};
+            if ((bits & 0x7C00) != 0x7C00 || (bits & 0x03FF) == 0)
+                BOOST_TEST(jb::basic::toFloat16(jb::basic::toFloat(half)).bits == half.bits);
+            else
+                BOOST_TEST(std::isnan(jb::basic::toFloat(half)));
+
+            jb::basic::BFloat16 brain{static_cast<std::uint16_t>(bits)};
+            if ((bits & 0x7F80) != 0x7F80 || (bits & 0x007F) == 0)
+                BOOST_TEST(jb::basic::toBFloat16(jb::basic::toFloat(brain)).bits == brain.bits);
+            else
+                BOOST_TEST(std::isnan(jb::basic::toFloat(brain)));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(half_precision_block_conversion)
+    {
+        // Built with -mf16c, the blocks of four complex numbers are converted by F16C instructions.
+        BOOST_TEST_MESSAGE("Comparing the block conversion of binary16 with the conversion of single numbers.");
+
+        using Conversion = jb::tools::HalfPrecisionConversion<jb::basic::Float16>;
+
+        // All numbers besides NaNs, followed by a remainder of less than a block.
+        std::vector<std::uint16_t> bits;
+        for (std::uint32_t value = 0; value <= 0xFFFF; ++value)
+            if ((value & 0x7C00) != 0x7C00 || (value & 0x03FF) == 0)
+                bits.push_back(static_cast<std::uint16_t>(value));
+        bits.resize(bits.size() + 6 - (bits.size() & 3), 0x3C00);
+
+        // Every number besides NaN converts to float and back exactly.
+        std::vector<jb::basic::ComplexFloat16> halves;
+        for (std::size_t i = 0; i < bits.size(); i += 2)
+            halves.emplace_back(std::complex<float>(jb::basic::toFloat(jb::basic::Float16{bits[i]}),
+                                                    jb::basic::toFloat(jb::basic::Float16{bits[i + 1]})));
+        std::vector<std::complex<float>> values(halves.size());
+
+        Conversion::load(&halves[0], &values[0], halves.size());
+        for (std::size_t i = 0; i < halves.size(); ++i)
+        {
+            BOOST_TEST(values[i].real() == jb::basic::toFloat(jb::basic::Float16{bits[2 * i]}));
+            BOOST_TEST(values[i].imag() == jb::basic::toFloat(jb::basic::Float16{bits[2 * i + 1]}));
+        }
+
+        // Values between the representable numbers, including ties, subnormals and overflows.
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = std::complex<float>(std::ldexp(static_cast<float>(i) - 16384.5f, -14), 1.0f + i * 0.0009765625f * 0.5f);
+        values.back() = std::complex<float>(70000.0f, -70000.0f);
+
+        Conversion::store(&values[0], &halves[0], values.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            BOOST_TEST(jb::basic::toFloat16(halves[i].real()).bits == jb::basic::toFloat16(values[i].real()).bits);
+            BOOST_TEST(jb::basic::toFloat16(halves[i].imag()).bits == jb::basic::toFloat16(values[i].imag()).bits);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(half_precision_float16)
+    {
+        BOOST_TEST_MESSAGE("Comparing FFTs on binary16 storage against double precision.");
+
+        const double kPrecision = 0.001;
+
+        compareFft<10, jbo::Radix_2, jbo::Decimation_In_Time, jb::basic::Float16>(kPrecision);
+        compareFft<12, jbo::Radix_Split_2_4, jbo::Decimation_In_Frequency, jb::basic::Float16>(kPrecision);
+        compareFft<5, jbo::Radix_4, jbo::Decimation_In_Time, jb::basic::Float16>(kPrecision);
+    }
+
+    BOOST_AUTO_TEST_CASE(half_precision_bfloat16)
+    {
+        BOOST_TEST_MESSAGE("Comparing FFTs on bfloat16 storage against double precision.");
+
+        const double kPrecision = 0.005;
+
+        compareFft<10, jbo::Radix_2, jbo::Decimation_In_Frequency, jb::basic::BFloat16>(kPrecision);
+        compareFft<12, jbo::Radix_Split_2_4, jbo::Decimation_In_Time, jb::basic::BFloat16>(kPrecision);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,85 @@
+#include <boost/math/constants/constants.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../../JeanBaptiste/include/transforms/HilbertTransform.h"
+#include <string>
+#include <vector>
+
+namespace constants = boost::math::constants;
+namespace ut = boost::unit_test;
+namespace jbo = jeanbaptiste::options;
+namespace jbt = jeanbaptiste::transforms;
+
+class HilbertTransformFixture
+{
+protected:
+    static constexpr unsigned kSampleCnt_ = 64;
+    const double kPrecision_ = 0.000000001;
+
+    std::vector<double> signal_;
+    std::vector<std::complex<double>> expected_;
+
+public:
+    HilbertTransformFixture()
+        : signal_(kSampleCnt_),
+          expected_(kSampleCnt_)
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: amplitude modulated carrier of 64 samples.");
+
+        // Periodic within the frame: the Hilbert transform of cos is sin.
+        for (std::size_t n = 0; n < kSampleCnt_; ++n)
+        {
+            const auto carrier = constants::two_pi<double>() * 12.0 * n / kSampleCnt_;
+            const auto modulation = constants::two_pi<double>() * 2.0 * n / kSampleCnt_;
+
+            // (1 + 0.5 cos(m)) cos(c) = cos(c) + 0.25 cos(c + m) + 0.25 cos(c - m)
+            signal_[n] = 0.3 + (1.0 + 0.5 * std::cos(modulation)) * std::cos(carrier);
+            expected_[n] = 0.3 + std::polar(1.0, carrier) + 0.25 * std::polar(1.0, carrier + modulation)
+                + 0.25 * std::polar(1.0, carrier - modulation);
+        }
+    }
+
+    ~HilbertTransformFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(HilbertTransformTestSuite, HilbertTransformFixture)
+
+    BOOST_AUTO_TEST_CASE(analytic_signal)
+    {
+        BOOST_TEST_MESSAGE("Calculating the analytic signal and envelope with all radices.");
+
+        jbt::HilbertTransformFactory<1, 8, jbo::Radix_2, std::complex<double>> radix2Factory;
+        jbt::HilbertTransformFactory<1, 4, jbo::Radix_4, std::complex<double>> radix4Factory;
+        jbt::HilbertTransform<std::integral_constant<int, 6>, jbo::Radix_Split_2_4, std::complex<double>> splitRadix;
+
+        std::vector<std::complex<double>> output(kSampleCnt_);
+        splitRadix(&signal_[0], &output[0]);
+        for (std::size_t n = 0; n < kSampleCnt_; ++n)
+        {
+            BOOST_TEST(std::abs(output[n] - expected_[n]) < kPrecision_);
+            BOOST_TEST(std::abs(output[n].real() - signal_[n]) < kPrecision_);
+        }
+
+        // The mask depends on the order of the bins, so real and imaginary part are checked besides the envelope.
+        auto checkAnalyticSignal = [&](const auto& algorithm)
+        {
+            BOOST_TEST(algorithm->numberOfSamples() == kSampleCnt_);
+
+            std::vector<std::complex<double>> data(signal_.begin(), signal_.end());
+            (*algorithm)(&data[0]);
+            for (std::size_t n = 0; n < kSampleCnt_; ++n)
+            {
+                BOOST_TEST(std::abs(data[n].real() - expected_[n].real()) < kPrecision_);
+                BOOST_TEST(std::abs(data[n].imag() - expected_[n].imag()) < kPrecision_);
+                BOOST_TEST(std::abs(std::abs(data[n]) - std::abs(expected_[n])) < kPrecision_);
+            }
+        };
+
+        checkAnalyticSignal(radix2Factory.getAlgorithm(6));
+        checkAnalyticSignal(radix4Factory.getAlgorithm(3));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
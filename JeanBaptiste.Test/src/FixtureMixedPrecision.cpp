@@ -0,0 +1,101 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../include/TestSignal.h"
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class MixedPrecisionFixture
+{
+protected:
+    static constexpr unsigned kStage_ = 12;
+
+    std::vector<std::complex<double>> signal_;
+    // The normalized DFT of the signal, calculated by definition.
+    std::vector<std::complex<double>> reference_;
+
+    /** Runs a float algorithm of the given precision and returns its maximum error relative to the DFT of the signal.
+    */
+    template <typename Radix, typename Decimation, typename Precision, std::size_t Stage>
+    double calculateError(void) const
+    {
+        jb::AlgorithmFactory<Stage, Stage + 1, Radix, Decimation, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_Division_By_Length, std::complex<float>, jbo::WindowInput_Real, jbo::Spectrum_Complex,
+            Precision> floatFactory;
+
+        auto floatAlgorithm = floatFactory.getAlgorithm(Stage);
+        BOOST_TEST(floatAlgorithm->numberOfSamples() == reference_.size());
+
+        std::vector<std::complex<float>> data(signal_.begin(), signal_.end());
+        (*floatAlgorithm)(&data[0]);
+
+        double maximumError = 0;
+        for (std::size_t i = 0; i < data.size(); ++i)
+            maximumError = std::max(maximumError, std::abs(std::complex<double>(data[i]) - reference_[i]));
+
+        return maximumError;
+    }
+
+public:
+    MixedPrecisionFixture()
+        : signal_(Utilities::createSines(1 << kStage_))
+        , reference_(Utilities::calculateDft(signal_, 1, 1.0 / (1 << kStage_)))
+    {}
+
+    ~MixedPrecisionFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(MixedPrecisionTestSuite, MixedPrecisionFixture)
+
+    BOOST_AUTO_TEST_CASE(mixed_precision_radix2)
+    {
+        BOOST_TEST_MESSAGE("Comparing float radix 2 algorithms with float and double twiddle factors.");
+
+        auto dataError = calculateError<jbo::Radix_2, jbo::Decimation_In_Time, jbo::Precision_Data, kStage_>();
+        auto mixedError = calculateError<jbo::Radix_2, jbo::Decimation_In_Time, jbo::Precision_Mixed, kStage_>();
+        BOOST_TEST(mixedError < 0.0000001);
+        BOOST_TEST(mixedError < dataError);
+
+        dataError = calculateError<jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Precision_Data, kStage_>();
+        mixedError = calculateError<jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Precision_Mixed, kStage_>();
+        BOOST_TEST(mixedError < 0.0000001);
+        BOOST_TEST(mixedError < dataError);
+    }
+
+    BOOST_AUTO_TEST_CASE(mixed_precision_radix4)
+    {
+        BOOST_TEST_MESSAGE("Comparing float radix 4 algorithms with float and double twiddle factors.");
+
+        auto dataError = calculateError<jbo::Radix_4, jbo::Decimation_In_Time, jbo::Precision_Data, (kStage_ >> 1)>();
+        auto mixedError = calculateError<jbo::Radix_4, jbo::Decimation_In_Time, jbo::Precision_Mixed, (kStage_ >> 1)>();
+        BOOST_TEST(mixedError < 0.0000001);
+        BOOST_TEST(mixedError < dataError);
+
+        dataError = calculateError<jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Precision_Data, (kStage_ >> 1)>();
+        mixedError = calculateError<jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Precision_Mixed, (kStage_ >> 1)>();
+        BOOST_TEST(mixedError < 0.0000001);
+        BOOST_TEST(mixedError < dataError);
+    }
+
+    BOOST_AUTO_TEST_CASE(mixed_precision_split_radix)
+    {
+        BOOST_TEST_MESSAGE("Comparing float split radix algorithms with float and double twiddle factors.");
+
+        auto dataError = calculateError<jbo::Radix_Split_2_4, jbo::Decimation_In_Time, jbo::Precision_Data, kStage_>();
+        auto mixedError = calculateError<jbo::Radix_Split_2_4, jbo::Decimation_In_Time, jbo::Precision_Mixed, kStage_>();
+        BOOST_TEST(mixedError < 0.0000001);
+        BOOST_TEST(mixedError < dataError);
+
+        dataError = calculateError<jbo::Radix_Split_2_4, jbo::Decimation_In_Frequency, jbo::Precision_Data, kStage_>();
+        mixedError = calculateError<jbo::Radix_Split_2_4, jbo::Decimation_In_Frequency, jbo::Precision_Mixed, kStage_>();
+        BOOST_TEST(mixedError < 0.0000001);
+        BOOST_TEST(mixedError < dataError);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
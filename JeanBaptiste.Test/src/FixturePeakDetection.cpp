@@ -0,0 +1,114 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class PeakDetectionFixture
+{
+protected:
+    static constexpr unsigned kStage_ = 8;
+    static constexpr unsigned kSampleCnt_ = 1 << kStage_;
+
+    // Real sines at fractional bins of descending amplitude.
+    static constexpr double kFrequencies_[] = {20.3, 61.7, 100.45};
+    static constexpr double kAmplitudes_[] = {1.0, 0.5, 0.25};
+
+    std::vector<std::complex<double>> signal_;
+
+    /** Finds the three peaks of the signal and compares them with the frequencies and amplitudes of the sines.
+    */
+    template <typename Window, typename Interpolation>
+    void findPeaks(const double frequencyPrecision, const double amplitudePrecision) const
+    {
+        jb::AlgorithmFactory<2, 10, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, Window,
+            jbo::Normalization_Division_By_Length, std::complex<double>, jbo::WindowInput_Real,
+            jbo::Spectrum_Peaks<4, Interpolation>> factory;
+        auto algorithm = factory.getAlgorithm(kStage_);
+
+        auto data = signal_;
+        std::vector<jb::postprocessing::Peak<double>> peaks(4);
+        auto peakCnt = algorithm->findPeaks(&data[0], &peaks[0]);
+
+        // The side lobes of the rectangular window produce many weak local maxima as well.
+        BOOST_TEST(peakCnt.has_value());
+        BOOST_TEST(*peakCnt >= 3);
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            BOOST_TEST(std::abs(peaks[i].frequency - kFrequencies_[i]) < frequencyPrecision);
+            // The amplitudes are relative to the strongest one since the window attenuates all sines.
+            BOOST_TEST(std::abs(peaks[i].amplitude / peaks[0].amplitude - kAmplitudes_[i]) < amplitudePrecision);
+        }
+    }
+
+public:
+    PeakDetectionFixture()
+        : signal_(kSampleCnt_)
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: three real sines of 256 samples.");
+
+        for (std::size_t i = 0; i < signal_.size(); ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                signal_[i] += kAmplitudes_[j] * std::cos(2.0 * M_PI * kFrequencies_[j] * i / kSampleCnt_);
+    }
+
+    ~PeakDetectionFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(PeakDetectionTestSuite, PeakDetectionFixture)
+
+    BOOST_AUTO_TEST_CASE(peak_detection_parabolic)
+    {
+        BOOST_TEST_MESSAGE("Finding peaks using parabolic interpolation of a von Hann windowed signal.");
+
+        findPeaks<jbo::Window_vonHann, jbo::Interpolation_Parabolic>(0.05, 0.02);
+    }
+
+    BOOST_AUTO_TEST_CASE(peak_detection_jacobsen)
+    {
+        BOOST_TEST_MESSAGE("Finding peaks using Jacobsen's estimator on a signal without window.");
+
+        findPeaks<jbo::Window_None, jbo::Interpolation_Jacobsen>(0.02, 0.1);
+    }
+
+    BOOST_AUTO_TEST_CASE(peak_detection_normalization)
+    {
+        BOOST_TEST_MESSAGE("Normalizing the complex data as before without a peak buffer.");
+
+        jb::AlgorithmFactory<2, 10, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_Division_By_Length, std::complex<double>> complexFactory;
+        jb::AlgorithmFactory<2, 10, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_Division_By_Length, std::complex<double>, jbo::WindowInput_Real,
+            jbo::Spectrum_Peaks<2>> peakFactory;
+
+        auto expected = signal_;
+        auto data = signal_;
+        (*complexFactory.getAlgorithm(kStage_))(&expected[0]);
+        (*peakFactory.getAlgorithm(kStage_))(&data[0]);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+            BOOST_TEST(std::abs(data[i] - expected[i]) < 0.000000001);
+    }
+
+    BOOST_AUTO_TEST_CASE(peaks_unsupported)
+    {
+        BOOST_TEST_MESSAGE("Checking that an algorithm without peak detection reports it and leaves the buffers untouched.");
+
+        jb::AlgorithmFactory<2, 10, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_No, std::complex<double>, jbo::WindowInput_Real, jbo::Spectrum_Power> factory;
+
+        auto data = signal_;
+        std::vector<jb::postprocessing::Peak<double>> peaks(1, jb::postprocessing::Peak<double>{-1.0, -1.0});
+
+        BOOST_TEST(!factory.getAlgorithm(kStage_)->findPeaks(&data[0], &peaks[0]).has_value());
+        BOOST_TEST((data == signal_));
+        BOOST_TEST(peaks[0].frequency == -1.0);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,210 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include "../../JeanBaptiste/include/PlanFactory.h"
+#include <stdexcept>
+#include "../include/TestSignal.h"
+#include <thread>
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class PlanFixture
+{
+protected:
+    std::vector<std::complex<double>> signal_;
+
+    /** Runs a plan and an algorithm of the same options on the signal and compares their results.
+    */
+    template <typename Radix, typename Decimation, typename Window, typename Normalization, typename Direction,
+              std::size_t Begin, std::size_t End>
+    void compare(const jb::PlanFactory<Begin, End, Radix, Decimation, std::complex<double>>& planFactory,
+                 const jbo::WindowKind window, const jbo::NormalizationKind normalization, const jbo::DirectionKind direction)
+    {
+        jb::AlgorithmFactory<Begin, End, Radix, Decimation, Direction, Window, Normalization, std::complex<double>> factory;
+
+        for (std::size_t stage = Begin; stage < End; ++stage)
+        {
+            auto plan = planFactory.getAlgorithm(stage, window, normalization, direction);
+            auto algorithm = factory.getAlgorithm(stage);
+            BOOST_TEST(plan->numberOfSamples() == algorithm->numberOfSamples());
+            BOOST_TEST(plan->numberOfFrequencies() == algorithm->numberOfFrequencies());
+
+            std::vector<std::complex<double>> expected(signal_.begin(), signal_.begin() + algorithm->numberOfSamples());
+            std::vector<std::complex<double>> data(expected);
+
+            (*algorithm)(&expected[0]);
+            (*plan)(&data[0]);
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+                BOOST_TEST(data[i] == expected[i]);
+        }
+    }
+
+public:
+    PlanFixture()
+        : signal_(Utilities::createSines(1 << 8))
+    {}
+
+    ~PlanFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(PlanTestSuite, PlanFixture)
+
+    BOOST_AUTO_TEST_CASE(plan_radix2)
+    {
+        BOOST_TEST_MESSAGE("Comparing radix 2 plans with algorithms of the same options.");
+
+        jb::PlanFactory<1, 9, jbo::Radix_2, jbo::Decimation_In_Time, std::complex<double>> ditFactory;
+        compare<jbo::Radix_2, jbo::Decimation_In_Time, jbo::Window_vonHann, jbo::Normalization_Division_By_Length,
+            jbo::Direction_Backward>(ditFactory, jbo::WindowKind::vonHann, jbo::NormalizationKind::Division_By_Length,
+            jbo::DirectionKind::Backward);
+        compare<jbo::Radix_2, jbo::Decimation_In_Time, jbo::Window_Bartlett, jbo::Normalization_No,
+            jbo::Direction_Forward>(ditFactory, jbo::WindowKind::Bartlett, jbo::NormalizationKind::No,
+            jbo::DirectionKind::Forward);
+
+        jb::PlanFactory<1, 9, jbo::Radix_2, jbo::Decimation_In_Frequency, std::complex<double>> difFactory;
+        compare<jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Window_BlackmanHarris, jbo::Normalization_Square_Root,
+            jbo::Direction_Forward>(difFactory, jbo::WindowKind::BlackmanHarris, jbo::NormalizationKind::Square_Root,
+            jbo::DirectionKind::Forward);
+    }
+
+    BOOST_AUTO_TEST_CASE(plan_radix4)
+    {
+        BOOST_TEST_MESSAGE("Comparing radix 4 plans with algorithms of the same options.");
+
+        jb::PlanFactory<1, 5, jbo::Radix_4, jbo::Decimation_In_Frequency, std::complex<double>> difFactory;
+        compare<jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Window_None, jbo::Normalization_Division_By_Length,
+            jbo::Direction_Backward>(difFactory, jbo::WindowKind::None, jbo::NormalizationKind::Division_By_Length,
+            jbo::DirectionKind::Backward);
+        compare<jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Window_Welch, jbo::Normalization_Square_Root,
+            jbo::Direction_Backward>(difFactory, jbo::WindowKind::Welch, jbo::NormalizationKind::Square_Root,
+            jbo::DirectionKind::Backward);
+
+        jb::PlanFactory<1, 5, jbo::Radix_4, jbo::Decimation_In_Time, std::complex<double>> ditFactory;
+        compare<jbo::Radix_4, jbo::Decimation_In_Time, jbo::Window_Hamming, jbo::Normalization_No,
+            jbo::Direction_Forward>(ditFactory, jbo::WindowKind::Hamming, jbo::NormalizationKind::No,
+            jbo::DirectionKind::Forward);
+    }
+
+    BOOST_AUTO_TEST_CASE(plan_split_radix)
+    {
+        BOOST_TEST_MESSAGE("Comparing split radix plans with algorithms of the same options.");
+
+        jb::PlanFactory<1, 9, jbo::Radix_Split_2_4, jbo::Decimation_In_Time, std::complex<double>> factory;
+        compare<jbo::Radix_Split_2_4, jbo::Decimation_In_Time, jbo::Window_Hamming, jbo::Normalization_Square_Root,
+            jbo::Direction_Backward>(factory, jbo::WindowKind::Hamming, jbo::NormalizationKind::Square_Root,
+            jbo::DirectionKind::Backward);
+    }
+
+    BOOST_AUTO_TEST_CASE(plan_round_trip)
+    {
+        BOOST_TEST_MESSAGE("Checking that a backward plan inverts a forward plan of the same factory.");
+
+        jb::PlanFactory<6, 7, jbo::Radix_Split_2_4, jbo::Decimation_In_Frequency, std::complex<double>> factory;
+        auto forward = factory.getAlgorithm(6);
+        auto backward = factory.getAlgorithm(6, jbo::WindowKind::None, jbo::NormalizationKind::Division_By_Length,
+            jbo::DirectionKind::Backward);
+
+        std::vector<std::complex<double>> data(signal_.begin(), signal_.begin() + 64);
+        (*forward)(&data[0]);
+        (*backward)(&data[0]);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+            BOOST_TEST(std::abs(data[i] - signal_[i]) < 0.000000001);
+    }
+
+    BOOST_AUTO_TEST_CASE(plan_cache_shared_instances)
+    {
+        BOOST_TEST_MESSAGE("Checking that cached plans are shared by factories and equal created plans.");
+
+        using CacheType = jb::PlanCache<jbo::Radix_2, jbo::Decimation_In_Frequency, std::complex<double>, jbo::WindowInput_Complex>;
+
+        jb::PlanFactory<1, 9, jbo::Radix_2, jbo::Decimation_In_Frequency, std::complex<double>, jbo::WindowInput_Complex> factory;
+        jb::PlanFactory<7, 8, jbo::Radix_2, jbo::Decimation_In_Frequency, std::complex<double>, jbo::WindowInput_Complex>
+            otherFactory;
+        auto size = CacheType::size();
+
+        const auto& plan = factory.getAlgorithmInstance(7, jbo::WindowKind::Welch, jbo::NormalizationKind::Square_Root);
+        BOOST_TEST(CacheType::size() == size + 1);
+        BOOST_TEST(&plan == &factory.getAlgorithmInstance(7, jbo::WindowKind::Welch, jbo::NormalizationKind::Square_Root));
+        BOOST_TEST(&plan == &otherFactory.getAlgorithmInstance(7, jbo::WindowKind::Welch, jbo::NormalizationKind::Square_Root));
+        BOOST_TEST(CacheType::size() == size + 1);
+
+        BOOST_TEST(&plan != &factory.getAlgorithmInstance(7, jbo::WindowKind::Welch, jbo::NormalizationKind::Square_Root,
+            jbo::DirectionKind::Backward));
+        BOOST_TEST(&plan != &factory.getAlgorithmInstance(8, jbo::WindowKind::Welch, jbo::NormalizationKind::Square_Root));
+        BOOST_TEST(CacheType::size() == size + 3);
+
+        std::vector<std::complex<double>> expected(signal_.begin(), signal_.begin() + 128);
+        std::vector<std::complex<double>> data(expected);
+        (*factory.getAlgorithm(7, jbo::WindowKind::Welch, jbo::NormalizationKind::Square_Root))(&expected[0]);
+        plan(&data[0]);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+            BOOST_TEST(data[i] == expected[i]);
+    }
+
+    BOOST_AUTO_TEST_CASE(plan_cache_failed_creation)
+    {
+        BOOST_TEST_MESSAGE("Checking that a plan whose creation throws is not cached and is created on the next request.");
+
+        using Complex = std::complex<double>;
+        using CacheType = jb::PlanCache<jbo::Radix_4, jbo::Decimation_In_Time, Complex>;
+
+        jb::PlanFactory<1, 5, jbo::Radix_4, jbo::Decimation_In_Time, Complex> factory;
+        auto size = CacheType::size();
+
+        BOOST_CHECK_THROW(CacheType::getPlan(3, jbo::WindowKind::Cosine, jbo::NormalizationKind::No,
+            jbo::DirectionKind::Forward, false, []() -> std::unique_ptr<jb::ExecutableAlgorithm<Complex>>
+        {
+            throw std::runtime_error("Plan creation failed.");
+        }), std::runtime_error);
+        BOOST_TEST(CacheType::size() == size);
+
+        const auto& plan = factory.getAlgorithmInstance(3, jbo::WindowKind::Cosine);
+        BOOST_TEST(CacheType::size() == size + 1);
+        BOOST_TEST(plan.numberOfSamples() == 64);
+
+        std::vector<Complex> expected(signal_.begin(), signal_.begin() + 64);
+        std::vector<Complex> data(expected);
+        (*factory.getAlgorithm(3, jbo::WindowKind::Cosine))(&expected[0]);
+        plan(&data[0]);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+            BOOST_TEST(data[i] == expected[i]);
+    }
+
+    BOOST_AUTO_TEST_CASE(plan_cache_threads)
+    {
+        BOOST_TEST_MESSAGE("Checking that threads requesting the same plans concurrently get the same instances.");
+
+        jb::PlanFactory<1, 9, jbo::Radix_Split_2_4, jbo::Decimation_In_Frequency, std::complex<double>> factory;
+        constexpr std::size_t kThreadCnt = 4;
+        std::vector<std::vector<const jb::ExecutableAlgorithm<std::complex<double>>*>> plans(kThreadCnt);
+        std::vector<std::thread> threads;
+
+        for (std::size_t i = 0; i < kThreadCnt; ++i)
+        {
+            threads.emplace_back([&factory, &threadPlans = plans[i]]()
+            {
+                for (std::size_t stage = 1; stage < 9; ++stage)
+                    threadPlans.push_back(&factory.getAlgorithmInstance(stage, jbo::WindowKind::None,
+                        jbo::NormalizationKind::Division_By_Length, jbo::DirectionKind::Backward));
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (std::size_t i = 1; i < kThreadCnt; ++i)
+            BOOST_TEST(plans[i] == plans[0]);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
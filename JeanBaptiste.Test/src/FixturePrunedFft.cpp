@@ -0,0 +1,72 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../../JeanBaptiste/include/PrunedAlgorithmFactory.h"
+#include <string>
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class PrunedFftFixture
+{
+protected:
+    static constexpr unsigned kStage_ = 7;
+    static constexpr unsigned kSampleCnt_ = 1 << kStage_;
+    const double kPrecision_ = 0.000000001;
+
+    /** Compares the leading frequencies of a pruned FFT with those of a full FFT of the zero padded input.
+        \param InputDivisor ... Only the first N / InputDivisor samples are non zero.
+        \param OutputDivisor ... Only the first N / OutputDivisor frequencies are compared.
+    */
+    template <typename Decimation, typename Direction, std::size_t InputDivisor, std::size_t OutputDivisor>
+    void compareWithFullFft(void) const
+    {
+        jb::AlgorithmFactory<kStage_, kStage_ + 1, jbo::Radix_2, Decimation, Direction, jbo::Window_None,
+            jbo::Normalization_No, std::complex<double>> fullFactory;
+        jb::PrunedAlgorithmFactory<kStage_ - 2, kStage_ + 1, Decimation, Direction, jbo::Window_None,
+            jbo::Normalization_No, std::complex<double>, InputDivisor, OutputDivisor> prunedFactory;
+
+        std::vector<std::complex<double>> expected(kSampleCnt_);
+        for (std::size_t i = 0; i < kSampleCnt_ / InputDivisor; ++i)
+            expected[i] = std::complex<double>(std::sin(0.37 * i) + 0.2 * i, std::cos(1.3 * i));
+        auto data = expected;
+
+        (*fullFactory.getAlgorithm(kStage_))(&expected[0]);
+        (*prunedFactory.getAlgorithm(kStage_))(&data[0]);
+
+        for (std::size_t k = 0; k < kSampleCnt_ / OutputDivisor; ++k)
+            BOOST_TEST(std::abs(data[k] - expected[k]) < kPrecision_);
+    }
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(PrunedFftTestSuite, PrunedFftFixture)
+
+    BOOST_AUTO_TEST_CASE(pruned_radix_2_dit)
+    {
+        BOOST_TEST_MESSAGE("Comparing input and output pruned radix 2 DIT FFTs with full FFTs.");
+
+        compareWithFullFft<jbo::Decimation_In_Time, jbo::Direction_Forward, 1, 1>();
+        compareWithFullFft<jbo::Decimation_In_Time, jbo::Direction_Forward, 8, 1>();
+        compareWithFullFft<jbo::Decimation_In_Time, jbo::Direction_Forward, 1, 16>();
+        compareWithFullFft<jbo::Decimation_In_Time, jbo::Direction_Backward, 8, 4>();
+        compareWithFullFft<jbo::Decimation_In_Time, jbo::Direction_Forward, 128, 128>();
+        compareWithFullFft<jbo::Decimation_In_Time, jbo::Direction_Backward, 3, 5>();
+    }
+
+    BOOST_AUTO_TEST_CASE(pruned_radix_2_dif)
+    {
+        BOOST_TEST_MESSAGE("Comparing input and output pruned radix 2 DIF FFTs with full FFTs.");
+
+        compareWithFullFft<jbo::Decimation_In_Frequency, jbo::Direction_Forward, 1, 1>();
+        compareWithFullFft<jbo::Decimation_In_Frequency, jbo::Direction_Forward, 8, 1>();
+        compareWithFullFft<jbo::Decimation_In_Frequency, jbo::Direction_Forward, 1, 16>();
+        compareWithFullFft<jbo::Decimation_In_Frequency, jbo::Direction_Backward, 8, 4>();
+        compareWithFullFft<jbo::Decimation_In_Frequency, jbo::Direction_Forward, 128, 128>();
+        compareWithFullFft<jbo::Decimation_In_Frequency, jbo::Direction_Backward, 3, 5>();
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,8 +1,11 @@
 #include <boost/test/unit_test.hpp>
+#include <cmath>
 #include <complex>
 #include "../../JeanBaptiste/include/AlgorithmFactory.h"
 #include "../include/AlgorithmFixture.h"
 #include <string>
+#include "../include/TestSignal.h"
+#include <vector>
 
 namespace ut = boost::unit_test;
 namespace jb = jeanbaptiste;
@@ -65,4 +68,42 @@ BOOST_FIXTURE_TEST_SUITE(Radix4TestSuite, Radix4Fixture)
         runAlgorithms(fftFactory.getAlgorithm(3), ifftFactory.getAlgorithm(3));
     }
 
+    BOOST_AUTO_TEST_CASE(fft_radix_4_windowed)
+    {
+        BOOST_TEST_MESSAGE("Comparing windowed radix 4 FFTs with a DFT of the signal windowed over all 4^stage samples.");
+
+        jb::AlgorithmFactory<1, 5, jbo::Radix_4, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_Hamming,
+            jbo::Normalization_No, std::complex<double>> ditFactory;
+        jb::AlgorithmFactory<1, 5, jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Direction_Forward, jbo::Window_Hamming,
+            jbo::Normalization_No, std::complex<double>> difFactory;
+
+        for (std::size_t stage = 1; stage < 5; ++stage)
+        {
+            const std::size_t sampleCnt = std::size_t{1} << (stage << 1);
+            const auto signal = Utilities::createSines(sampleCnt);
+
+            // Hamming window centered at sampleCnt / 2, see HammingWindow. WindowInput_Real scales the real part only.
+            std::vector<std::complex<double>> windowed(signal);
+            for (std::size_t i = 0; i < sampleCnt; ++i)
+            {
+                const double window = 0.54 + 0.46 * std::cos(2.0 * M_PI * (static_cast<double>(i) - (sampleCnt >> 1))
+                    / sampleCnt);
+                windowed[i].real(windowed[i].real() * window);
+            }
+
+            const auto expected = Utilities::calculateDft(windowed, 1);
+
+            for (const auto& algorithm : {ditFactory.getAlgorithm(stage), difFactory.getAlgorithm(stage)})
+            {
+                BOOST_TEST(algorithm->numberOfSamples() == sampleCnt);
+
+                std::vector<std::complex<double>> data(signal);
+                (*algorithm)(&data[0]);
+
+                for (std::size_t i = 0; i < sampleCnt; ++i)
+                    BOOST_TEST(std::abs(data[i] - expected[i]) < 0.000001);
+            }
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
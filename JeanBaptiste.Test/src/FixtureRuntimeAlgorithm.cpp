@@ -0,0 +1,165 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include "../../JeanBaptiste/include/PlanFactory.h"
+#include "../../JeanBaptiste/include/RuntimeAlgorithm.h"
+#include <stdexcept>
+#include "../include/TestSignal.h"
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class RuntimeAlgorithmFixture
+{
+protected:
+    std::vector<std::complex<double>> signal_;
+
+    /** Compares the results of a fallback algorithm of a factory of the stages [1, Begin) with the ones of the compiled
+        algorithms of a factory of the stages [Begin, End).
+    */
+    template <std::size_t Begin, std::size_t End, typename Radix, typename Decimation, typename Direction, typename Window,
+              typename Normalization, typename WindowInput, typename Complex>
+    void compare(const double precision)
+    {
+        jb::AlgorithmFactory<1, Begin, Radix, Decimation, Direction, Window, Normalization, Complex, WindowInput>
+            fallbackFactory;
+        jb::AlgorithmFactory<Begin, End, Radix, Decimation, Direction, Window, Normalization, Complex, WindowInput> factory;
+
+        for (std::size_t stage = Begin; stage < End; ++stage)
+        {
+            bool fallback = false;
+            auto runtimeAlgorithm = fallbackFactory.getAlgorithm(stage, &fallback);
+            auto algorithm = factory.getAlgorithm(stage);
+            BOOST_TEST(fallback);
+            BOOST_TEST(runtimeAlgorithm->numberOfSamples() == algorithm->numberOfSamples());
+            BOOST_TEST(runtimeAlgorithm->numberOfFrequencies() == algorithm->numberOfFrequencies());
+
+            std::vector<Complex> expected(algorithm->numberOfSamples());
+            for (std::size_t i = 0; i < expected.size(); ++i)
+                expected[i] = Complex(signal_[i % signal_.size()]);
+            std::vector<Complex> data(expected);
+
+            (*algorithm)(&expected[0]);
+            (*runtimeAlgorithm)(&data[0]);
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+                BOOST_TEST(std::abs(data[i] - expected[i]) < precision);
+        }
+    }
+
+public:
+    RuntimeAlgorithmFixture()
+        : signal_(Utilities::createSines(1 << 10))
+    {}
+
+    ~RuntimeAlgorithmFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(RuntimeAlgorithmTestSuite, RuntimeAlgorithmFixture)
+
+    BOOST_AUTO_TEST_CASE(runtime_algorithm_radix2)
+    {
+        BOOST_TEST_MESSAGE("Comparing radix 2 fallback algorithms with compiled algorithms.");
+
+        using Complex = std::complex<double>;
+
+        // Stage 4 runs radix 4 passes only, stage 5 an additional radix 2 pass.
+        compare<4, 10, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_vonHann,
+            jbo::Normalization_No, jbo::WindowInput_Real, Complex>(0.00000001);
+        compare<4, 10, jbo::Radix_2, jbo::Decimation_In_Frequency, jbo::Direction_Backward, jbo::Window_BlackmanHarris,
+            jbo::Normalization_Division_By_Length, jbo::WindowInput_Complex, Complex>(0.00000001);
+        compare<4, 10, jbo::Radix_Split_2_4, jbo::Decimation_In_Time, jbo::Direction_Backward_Conjugated, jbo::Window_Welch,
+            jbo::Normalization_Square_Root, jbo::WindowInput_Real, Complex>(0.00000001);
+    }
+
+    BOOST_AUTO_TEST_CASE(runtime_algorithm_radix4_float)
+    {
+        BOOST_TEST_MESSAGE("Comparing radix 4 and float fallback algorithms with compiled algorithms.");
+
+        compare<3, 6, jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_Division_By_Length, jbo::WindowInput_Real, std::complex<double>>(0.00000001);
+        compare<4, 9, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_FlatTop,
+            jbo::Normalization_No, jbo::WindowInput_Complex, std::complex<float>>(0.001);
+    }
+
+    BOOST_AUTO_TEST_CASE(runtime_algorithm_windows)
+    {
+        BOOST_TEST_MESSAGE("Comparing the windows of fallback algorithms with the windows of compiled algorithms.");
+
+        constexpr std::size_t kStage = 6;
+        jb::PlanFactory<kStage, kStage + 1, jbo::Radix_2, jbo::Decimation_In_Time, std::complex<double>> factory;
+        jb::PlanFactory<1, 2, jbo::Radix_2, jbo::Decimation_In_Time, std::complex<double>> fallbackFactory;
+
+        for (std::size_t window = 0; window <= static_cast<std::size_t>(jbo::WindowKind::Welch); ++window)
+        {
+            bool fallback = false;
+            auto plan = factory.getAlgorithm(kStage, static_cast<jbo::WindowKind>(window));
+            auto runtimePlan = fallbackFactory.getAlgorithm(kStage, static_cast<jbo::WindowKind>(window),
+                jbo::NormalizationKind::No, jbo::DirectionKind::Forward, &fallback);
+            BOOST_TEST(fallback);
+
+            std::vector<std::complex<double>> expected(signal_.begin(), signal_.begin() + (1 << kStage));
+            std::vector<std::complex<double>> data(expected);
+            (*plan)(&expected[0]);
+            (*runtimePlan)(&data[0]);
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+                BOOST_TEST(std::abs(data[i] - expected[i]) < 0.00000001);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(runtime_algorithm_report)
+    {
+        BOOST_TEST_MESSAGE("Checking that factories report whether they fall back.");
+
+        jb::SparseAlgorithmFactory<std::index_sequence<3, 5>, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward,
+            jbo::Window_None, jbo::Normalization_No, std::complex<double>> factory;
+        bool fallback = true;
+
+        factory.getAlgorithm(5, &fallback);
+        BOOST_TEST(!fallback);
+        BOOST_TEST(factory.getAlgorithm(4, &fallback)->numberOfSamples() == 16);
+        BOOST_TEST(fallback);
+        BOOST_TEST(factory.getAlgorithm(12)->numberOfSamples() == 4096);
+
+        jb::PlanFactory<3, 4, jbo::Radix_2, jbo::Decimation_In_Time, std::complex<double>> planFactory;
+        const auto& plan = planFactory.getAlgorithmInstance(3, jbo::WindowKind::None, jbo::NormalizationKind::No,
+            jbo::DirectionKind::Forward, &fallback);
+        BOOST_TEST(!fallback);
+        const auto& runtimePlan = planFactory.getAlgorithmInstance(11, jbo::WindowKind::None, jbo::NormalizationKind::No,
+            jbo::DirectionKind::Forward, &fallback);
+        BOOST_TEST(fallback);
+        BOOST_TEST(runtimePlan.numberOfSamples() == 2048);
+        BOOST_TEST(&runtimePlan == &planFactory.getAlgorithmInstance(11));
+        BOOST_TEST(&plan != &runtimePlan);
+    }
+
+    BOOST_AUTO_TEST_CASE(runtime_algorithm_oversized_stage)
+    {
+        BOOST_TEST_MESSAGE("Checking that factories reject fallback stages of more samples than supported.");
+
+        jb::AlgorithmFactory<3, 5, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_No, std::complex<double>> factory;
+        BOOST_CHECK_THROW(factory.getAlgorithm(std::numeric_limits<std::size_t>::digits), std::length_error);
+        BOOST_CHECK_THROW(factory.getAlgorithm(std::numeric_limits<std::size_t>::digits - 1), std::length_error);
+        BOOST_CHECK_THROW(factory.getAlgorithm(1000), std::length_error);
+
+        jb::AlgorithmFactory<2, 3, jbo::Radix_4, jbo::Decimation_In_Frequency, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_No, std::complex<double>> radix4Factory;
+        BOOST_CHECK_THROW(radix4Factory.getAlgorithm(std::numeric_limits<std::size_t>::digits / 2), std::length_error);
+        BOOST_CHECK_THROW(radix4Factory.getAlgorithm(std::numeric_limits<std::size_t>::digits), std::length_error);
+        BOOST_TEST(radix4Factory.getAlgorithm(4)->numberOfSamples() == 256);
+
+        jb::PlanFactory<3, 4, jbo::Radix_4, jbo::Decimation_In_Time, std::complex<double>> planFactory;
+        BOOST_CHECK_THROW(planFactory.getAlgorithm(std::numeric_limits<std::size_t>::digits / 2), std::length_error);
+        BOOST_CHECK_THROW(planFactory.getAlgorithmInstance(std::numeric_limits<std::size_t>::digits / 2), std::length_error);
+        BOOST_TEST(planFactory.getAlgorithmInstance(2).numberOfSamples() == 16);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
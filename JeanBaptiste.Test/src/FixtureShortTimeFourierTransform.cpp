@@ -0,0 +1,133 @@
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include "../../JeanBaptiste/include/streaming/InverseShortTimeFourierTransform.h"
+#include "../../JeanBaptiste/include/streaming/ShortTimeFourierTransform.h"
+#include <string>
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+namespace jbs = jeanbaptiste::streaming;
+
+class ShortTimeFourierTransformFixture
+{
+protected:
+    static constexpr unsigned kStage_ = 5;
+    static constexpr unsigned kSampleCnt_ = 1 << kStage_;
+    static constexpr unsigned kSignalLength_ = 300;
+    const double kPrecision_ = 0.000000001;
+
+    std::vector<double> signal_;
+
+public:
+    ShortTimeFourierTransformFixture()
+        : signal_(kSignalLength_)
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: sum of two cosines of 300 samples.");
+
+        for (std::size_t i = 0; i < signal_.size(); ++i)
+            signal_[i] = std::cos(0.3 * i) + 0.5 * std::cos(1.7 * i + 0.2);
+    }
+
+    ~ShortTimeFourierTransformFixture()
+    {}
+
+    /** Pushes the signal in blocks of varying size and compares each frame with a separately transformed slice of the signal.
+    */
+    void checkFrames(const std::size_t hopSize)
+    {
+        jbs::ShortTimeFourierTransform<4, 7, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Window_vonHann, jbo::Normalization_No,
+            std::complex<double>> stft(kStage_, hopSize);
+
+        jb::AlgorithmFactory<4, 7, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_vonHann,
+            jbo::Normalization_No, std::complex<double>> fftFactory;
+        auto fft = fftFactory.getAlgorithm(kStage_);
+
+        std::size_t frames = 0;
+        auto handler = [&](const std::complex<double>* spectrum, const std::size_t frameIndex)
+        {
+            BOOST_TEST(frameIndex == frames);
+
+            std::vector<std::complex<double>> expected(signal_.begin() + frameIndex * hopSize,
+                signal_.begin() + frameIndex * hopSize + kSampleCnt_);
+            fft->operator()(&expected[0]);
+
+            for (std::size_t i = 0; i < kSampleCnt_; ++i)
+                BOOST_TEST(std::abs(spectrum[i] - expected[i]) < kPrecision_);
+
+            ++frames;
+        };
+
+        const std::size_t blockSizes[] = {1, 7, 50, 3, 32, 64, 13};
+        for (std::size_t position = 0, block = 0; position < signal_.size(); ++block)
+        {
+            auto count = std::min(blockSizes[block % 7], signal_.size() - position);
+            stft.push(&signal_[position], count, handler);
+            position += count;
+        }
+
+        BOOST_TEST(frames == (kSignalLength_ - kSampleCnt_) / hopSize + 1);
+    }
+
+    /** Analyzes and resynthesizes the signal and compares the result with the original signal.
+        The first frame length - hop size samples are skipped since they are not fully overlapped.
+    */
+    template <typename Radix, std::size_t Begin, std::size_t End>
+    void checkRoundTrip(const std::size_t stage, const std::size_t hopSize)
+    {
+        jbs::ShortTimeFourierTransform<Begin, End, Radix, jbo::Decimation_In_Frequency, jbo::Window_vonHann, jbo::Normalization_No,
+            std::complex<double>> stft(stage, hopSize);
+        jbs::InverseShortTimeFourierTransform<Begin, End, Radix, jbo::Decimation_In_Frequency, jbo::Window_vonHann,
+            jbo::Normalization_Division_By_Length, std::complex<double>> istft(stage, hopSize);
+
+        std::vector<double> output;
+        std::vector<double> block(hopSize);
+        stft.push(&signal_[0], signal_.size(), [&](const std::complex<double>* spectrum, const std::size_t)
+        {
+            istft.push(spectrum, &block[0]);
+            output.insert(output.end(), block.begin(), block.end());
+        });
+
+        BOOST_TEST(output.size() > istft.frameLength());
+        for (auto i = istft.frameLength() - hopSize; i < output.size(); ++i)
+            BOOST_TEST(std::abs(output[i] - signal_[i]) < kPrecision_);
+    }
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(ShortTimeFourierTransformTestSuite, ShortTimeFourierTransformFixture)
+
+    BOOST_AUTO_TEST_CASE(stft_overlapping_frames)
+    {
+        BOOST_TEST_MESSAGE("Running STFT with hop size 12 on a frame length of 32.");
+
+        checkFrames(12);
+    }
+
+    BOOST_AUTO_TEST_CASE(stft_adjacent_frames)
+    {
+        BOOST_TEST_MESSAGE("Running STFT with hop size 32 on a frame length of 32.");
+
+        checkFrames(kSampleCnt_);
+    }
+
+    BOOST_AUTO_TEST_CASE(stft_istft_round_trip)
+    {
+        BOOST_TEST_MESSAGE("Running STFT and ISTFT with von Hann window and hop sizes 8 and 12 on a frame length of 32.");
+
+        checkRoundTrip<jbo::Radix_2, 4, 7>(kStage_, 8);
+        checkRoundTrip<jbo::Radix_2, 4, 7>(kStage_, 12);
+    }
+
+    BOOST_AUTO_TEST_CASE(stft_istft_round_trip_radix4)
+    {
+        BOOST_TEST_MESSAGE("Running radix 4 STFT and ISTFT with von Hann window and hop sizes 16 and 24 on a frame length of 64.");
+
+        checkRoundTrip<jbo::Radix_4, 2, 4>(3, 16);
+        checkRoundTrip<jbo::Radix_4, 2, 4>(3, 24);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
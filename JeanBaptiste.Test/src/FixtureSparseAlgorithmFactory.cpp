@@ -0,0 +1,81 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../include/TestSignal.h"
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class SparseAlgorithmFactoryFixture
+{
+protected:
+    using SparseFactoryType = jb::SparseAlgorithmFactory<std::index_sequence<3, 6, 9>, jbo::Radix_Split_2_4,
+        jbo::Decimation_In_Frequency, jbo::Direction_Forward, jbo::Window_Hamming, jbo::Normalization_Square_Root,
+        std::complex<double>>;
+    using FactoryType = jb::AlgorithmFactory<3, 10, jbo::Radix_Split_2_4, jbo::Decimation_In_Frequency,
+        jbo::Direction_Forward, jbo::Window_Hamming, jbo::Normalization_Square_Root, std::complex<double>>;
+
+    static constexpr std::size_t kStages_[] = {3, 6, 9};
+
+    SparseFactoryType sparseFactory_;
+    FactoryType factory_;
+    std::vector<std::complex<double>> signal_;
+
+public:
+    SparseAlgorithmFactoryFixture()
+        : signal_(Utilities::createSines(1 << 9))
+    {}
+
+    ~SparseAlgorithmFactoryFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(SparseAlgorithmFactoryTestSuite, SparseAlgorithmFactoryFixture)
+
+    BOOST_AUTO_TEST_CASE(sparse_algorithm_factory_same_algorithms)
+    {
+        BOOST_TEST_MESSAGE("Checking that the listed stages are the algorithms of a factory of a contiguous range.");
+
+        BOOST_TEST((std::is_same_v<SparseFactoryType::AlgorithmOfStage<6>, FactoryType::AlgorithmOfStage<6>>));
+        BOOST_TEST(std::variant_size_v<SparseFactoryType::AlgorithmVariant> == 3);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            auto stage = kStages_[i];
+            auto sparseAlgorithm = sparseFactory_.getAlgorithm(stage);
+            BOOST_TEST(sparseAlgorithm->numberOfSamples() == (std::size_t{1} << stage));
+            BOOST_TEST(sparseFactory_.getAlgorithmVariant(stage).index() == i);
+            BOOST_TEST(&sparseFactory_.getAlgorithmInstance(stage) == &SparseFactoryType().getAlgorithmInstance(stage));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(sparse_algorithm_factory_results)
+    {
+        BOOST_TEST_MESSAGE("Comparing the results of a sparse factory with the ones of a factory of a contiguous range.");
+
+        for (auto stage : kStages_)
+        {
+            std::vector<std::complex<double>> expected(signal_.begin(), signal_.begin() + (std::size_t{1} << stage));
+            std::vector<std::complex<double>> data(expected);
+            std::vector<std::complex<double>> variantData(expected);
+
+            (*factory_.getAlgorithm(stage))(&expected[0]);
+            (*sparseFactory_.getAlgorithm(stage))(&data[0]);
+            SparseFactoryType::execute(sparseFactory_.getAlgorithmVariant(stage), &variantData[0]);
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+            {
+                BOOST_TEST(data[i] == expected[i]);
+                BOOST_TEST(variantData[i] == expected[i]);
+            }
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
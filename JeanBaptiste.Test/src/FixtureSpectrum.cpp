@@ -0,0 +1,118 @@
+#include "../../JeanBaptiste/include/AlgorithmFactory.h"
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <string>
+#include "../include/TestSignal.h"
+#include <vector>
+
+namespace ut = boost::unit_test;
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+class SpectrumFixture
+{
+protected:
+    static constexpr unsigned kStage_ = 6;
+    static constexpr unsigned kSampleCnt_ = 1 << kStage_;
+
+    std::vector<std::complex<double>> signal_;
+
+    /** Runs an algorithm putting out the selected spectrum and compares it with the converted output of an algorithm
+        putting out complex data.
+    */
+    template <typename Radix, typename Normalization, typename Spectrum, typename Complex, typename Conversion>
+    void compareSpectrum(const std::size_t stage, Conversion conversion, const double precision) const
+    {
+        using ValueType = typename Complex::value_type;
+
+        jb::AlgorithmFactory<2, 7, Radix, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_Hamming,
+            Normalization, Complex> complexFactory;
+        jb::AlgorithmFactory<2, 7, Radix, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_Hamming,
+            Normalization, Complex, jbo::WindowInput_Real, Spectrum> spectrumFactory;
+
+        auto complexAlgorithm = complexFactory.getAlgorithm(stage);
+        auto spectrumAlgorithm = spectrumFactory.getAlgorithm(stage);
+
+        std::vector<Complex> expected(complexAlgorithm->numberOfSamples());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            expected[i] = Complex(static_cast<ValueType>(signal_[i].real()), static_cast<ValueType>(signal_[i].imag()));
+        auto data = expected;
+
+        (*complexAlgorithm)(&expected[0]);
+
+        // Without a spectrum buffer the complex data is normalized as before.
+        (*spectrumAlgorithm)(&data[0]);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            BOOST_TEST(std::abs(data[i] - expected[i]) < precision);
+
+        std::vector<ValueType> spectrum(spectrumAlgorithm->numberOfFrequencies());
+        std::copy(signal_.begin(), signal_.begin() + data.size(), data.begin());
+        BOOST_TEST(spectrumAlgorithm->calculateSpectrum(&data[0], &spectrum[0]));
+        for (std::size_t k = 0; k < spectrum.size(); ++k)
+            BOOST_TEST(std::abs(spectrum[k] - conversion(expected[k])) < precision);
+    }
+
+public:
+    SpectrumFixture()
+        : signal_(Utilities::createSines(1 << (kStage_ << 1)))
+    {}
+
+    ~SpectrumFixture()
+    {}
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(SpectrumTestSuite, SpectrumFixture)
+
+    BOOST_AUTO_TEST_CASE(spectrum_double)
+    {
+        BOOST_TEST_MESSAGE("Putting out magnitude, power, phase and dB spectra of double precision.");
+
+        using Complex = std::complex<double>;
+        const double kPrecision = 0.000000001;
+        // The logarithm is approximated.
+        const double kDecibelPrecision = 0.0000001;
+
+        compareSpectrum<jbo::Radix_2, jbo::Normalization_Square_Root, jbo::Spectrum_Magnitude, Complex>(kStage_,
+            [](const Complex& value) { return std::abs(value); }, kPrecision);
+        compareSpectrum<jbo::Radix_Split_2_4, jbo::Normalization_Division_By_Length, jbo::Spectrum_Power, Complex>(kStage_,
+            [](const Complex& value) { return std::norm(value); }, kPrecision);
+        compareSpectrum<jbo::Radix_4, jbo::Normalization_No, jbo::Spectrum_Phase, Complex>(3,
+            [](const Complex& value) { return std::arg(value); }, kPrecision);
+        compareSpectrum<jbo::Radix_2, jbo::Normalization_Square_Root, jbo::Spectrum_Decibel, Complex>(kStage_,
+            [](const Complex& value) { return 20.0 * std::log10(std::abs(value)); }, kDecibelPrecision);
+    }
+
+    BOOST_AUTO_TEST_CASE(spectrum_float)
+    {
+        BOOST_TEST_MESSAGE("Putting out magnitude and dB spectra of single precision.");
+
+        using Complex = std::complex<float>;
+        const double kPrecision = 0.0001;
+
+        compareSpectrum<jbo::Radix_2, jbo::Normalization_Division_By_Length, jbo::Spectrum_Magnitude, Complex>(kStage_,
+            [](const Complex& value) { return std::abs(value); }, kPrecision);
+        compareSpectrum<jbo::Radix_2, jbo::Normalization_No, jbo::Spectrum_Decibel, Complex>(5,
+            [](const Complex& value) { return 20.0f * std::log10(std::abs(value)); }, kPrecision);
+    }
+
+    BOOST_AUTO_TEST_CASE(spectrum_unsupported)
+    {
+        BOOST_TEST_MESSAGE("Checking that an algorithm without real spectrum reports it and leaves the buffers untouched.");
+
+        jb::AlgorithmFactory<2, 7, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_Hamming,
+            jbo::Normalization_No, std::complex<double>> complexFactory;
+        auto algorithm = complexFactory.getAlgorithm(kStage_);
+
+        std::vector<std::complex<double>> data(signal_.begin(), signal_.begin() + kSampleCnt_);
+        std::vector<double> spectrum(algorithm->numberOfFrequencies(), -1.0);
+
+        BOOST_TEST(!algorithm->calculateSpectrum(&data[0], &spectrum[0]));
+        BOOST_TEST(std::equal(data.begin(), data.end(), signal_.begin()));
+        for (auto value : spectrum)
+            BOOST_TEST(value == -1.0);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
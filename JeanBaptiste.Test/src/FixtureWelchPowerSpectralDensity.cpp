@@ -0,0 +1,135 @@
+#include <boost/math/constants/constants.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include "../../JeanBaptiste/include/streaming/WelchPowerSpectralDensity.h"
+#include "../../JeanBaptiste/include/windowing/VonHannWindow.h"
+#include <string>
+#include <vector>
+
+namespace constants = boost::math::constants;
+namespace ut = boost::unit_test;
+namespace jbo = jeanbaptiste::options;
+namespace jbs = jeanbaptiste::streaming;
+namespace jw = jeanbaptiste::windowing;
+
+class WelchPowerSpectralDensityFixture
+{
+protected:
+    static constexpr unsigned kStage_ = 6;
+    static constexpr unsigned kSampleCnt_ = 1 << kStage_;
+    static constexpr unsigned kHopSize_ = kSampleCnt_ / 2;
+    static constexpr unsigned kSignalLength_ = 1000;
+    const double kSamplingRate_ = 8000.0;
+    const double kPrecision_ = 0.000000001;
+
+    std::vector<double> signal_;
+
+public:
+    WelchPowerSpectralDensityFixture()
+        : signal_(kSignalLength_)
+    {
+        BOOST_TEST_MESSAGE("Setup fixture: two sines and a chirp of 1000 samples.");
+
+        for (std::size_t i = 0; i < signal_.size(); ++i)
+            signal_[i] = std::sin(0.4 * i) + 0.3 * std::sin(2.2 * i + 1.0) + 0.1 * std::sin(0.001 * i * i);
+    }
+
+    ~WelchPowerSpectralDensityFixture()
+    {}
+
+    /** Calculates the one sided Welch estimate of the signal using a DFT.
+    */
+    std::vector<double> calculateExpectedDensity(void) const
+    {
+        std::vector<double> window(kSampleCnt_);
+        double windowPower = 0.0;
+        for (std::size_t n = 0; n < kSampleCnt_; ++n)
+        {
+            window[n] = 0.5 * (1.0 + std::cos(constants::two_pi<double>() * (static_cast<double>(n) - kSampleCnt_ / 2) / kSampleCnt_));
+            windowPower += window[n] * window[n];
+        }
+
+        std::vector<double> density(kSampleCnt_ / 2 + 1);
+        std::size_t segments = 0;
+        for (std::size_t start = 0; start + kSampleCnt_ <= signal_.size(); start += kHopSize_, ++segments)
+        {
+            for (std::size_t k = 0; k < density.size(); ++k)
+            {
+                std::complex<double> sum;
+                for (std::size_t n = 0; n < kSampleCnt_; ++n)
+                    sum += signal_[start + n] * window[n] * std::polar(1.0, -constants::two_pi<double>() * k * n / kSampleCnt_);
+
+                density[k] += std::norm(sum);
+            }
+        }
+
+        for (std::size_t k = 0; k < density.size(); ++k)
+            density[k] *= ((k == 0 || k == density.size() - 1) ? 1.0 : 2.0) / (segments * kSamplingRate_ * windowPower);
+
+        return density;
+    }
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(WelchPowerSpectralDensityTestSuite, WelchPowerSpectralDensityFixture)
+
+    BOOST_AUTO_TEST_CASE(window_power_correction_factor)
+    {
+        BOOST_TEST_MESSAGE("Checking correction factors of a von Hann window.");
+
+        using Window = jw::VonHannWindow<std::integral_constant<int, kSampleCnt_>, std::complex<double>>;
+
+        BOOST_TEST(std::abs(Window::amplitudeCorrectionFactor() - 2.0) < kPrecision_);
+        BOOST_TEST(std::abs(Window::powerCorrectionFactor() - 8.0 / 3.0) < kPrecision_);
+    }
+
+    BOOST_AUTO_TEST_CASE(welch_one_sided)
+    {
+        BOOST_TEST_MESSAGE("Running Welch estimation with von Hann window and 50% overlap.");
+
+        jbs::WelchPowerSpectralDensity<5, 8, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Window_vonHann, std::complex<double>>
+            welch(kStage_, kHopSize_, kSamplingRate_);
+
+        // Push in two parts to check that the average runs across pushes.
+        welch.push(&signal_[0], 333);
+        welch.push(&signal_[333], signal_.size() - 333);
+
+        BOOST_TEST(welch.segmentCount() == (kSignalLength_ - kSampleCnt_) / kHopSize_ + 1);
+        BOOST_TEST(welch.numberOfBins() == kSampleCnt_ / 2 + 1);
+
+        std::vector<double> density(welch.numberOfBins());
+        welch.getPowerSpectralDensity(&density[0]);
+
+        auto expected = calculateExpectedDensity();
+        for (std::size_t k = 0; k < expected.size(); ++k)
+            BOOST_TEST(std::abs(density[k] - expected[k]) < kPrecision_);
+    }
+
+    BOOST_AUTO_TEST_CASE(welch_radix4)
+    {
+        BOOST_TEST_MESSAGE("Comparing Welch estimates of radix 4 and radix 2 algorithms of the same segment length.");
+
+        // The power correction factor of the Bartlett window depends on the window length, unlike cosine sum windows.
+
+        jbs::WelchPowerSpectralDensity<5, 8, jbo::Radix_2, jbo::Decimation_In_Time, jbo::Window_Bartlett, std::complex<double>>
+            radix2Welch(kStage_, kHopSize_, kSamplingRate_);
+        jbs::WelchPowerSpectralDensity<2, 4, jbo::Radix_4, jbo::Decimation_In_Time, jbo::Window_Bartlett, std::complex<double>>
+            radix4Welch(kStage_ >> 1, kHopSize_, kSamplingRate_);
+
+        radix2Welch.push(&signal_[0], signal_.size());
+        radix4Welch.push(&signal_[0], signal_.size());
+
+        BOOST_TEST(radix4Welch.segmentCount() == radix2Welch.segmentCount());
+        BOOST_TEST(radix4Welch.numberOfBins() == radix2Welch.numberOfBins());
+
+        std::vector<double> expected(radix2Welch.numberOfBins());
+        std::vector<double> density(radix4Welch.numberOfBins());
+        radix2Welch.getPowerSpectralDensity(&expected[0]);
+        radix4Welch.getPowerSpectralDensity(&density[0]);
+
+        for (std::size_t k = 0; k < expected.size(); ++k)
+            BOOST_TEST(std::abs(density[k] - expected[k]) < kPrecision_);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
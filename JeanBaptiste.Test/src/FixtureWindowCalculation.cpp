@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <boost/test/unit_test.hpp>
 #include <complex>
 #include "../include/WindowingAnalysis.h"
@@ -14,6 +15,7 @@
 
 namespace ut = boost::unit_test;
 namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
 namespace jt = jeanbaptiste::tools;
 namespace jw = jeanbaptiste::windowing;
 
@@ -161,6 +163,32 @@ BOOST_FIXTURE_TEST_SUITE(WindowCalculationTestSuite, WindowCalculationFixture)
         analysis_.checkOutput(realData, expectedOut_);
     }
 
+    BOOST_AUTO_TEST_CASE(von_hann_complex_input)
+    {
+        BOOST_TEST((initialized_ = analysis_.initialize("../../test cases/WinvonHannTest.xml", "win.in", workingSet_, "win.out", expectedOut_)), "Loading test data failed.");
+        if (!initialized_)
+            return;
+
+        BOOST_TEST_MESSAGE("Checking von Hann window samples on real and imaginary parts of complex data.");
+
+        jw::VonHannWindow<std::integral_constant<int, kSampleCnt_>, std::complex<double>, jbo::WindowInput_Complex> vonHannWin;
+
+        std::vector<std::complex<double>> complexData(workingSet_.size());
+        std::transform(workingSet_.begin(), workingSet_.end(), complexData.begin(), [](const double value)
+        {
+            return std::complex<double>(value, value);
+        });
+        vonHannWin(&complexData[0]);
+
+        std::vector<double> realData(complexData.size());
+        std::vector<double> imagData(complexData.size());
+        std::transform(complexData.begin(), complexData.end(), realData.begin(), [](const auto& value) { return value.real(); });
+        std::transform(complexData.begin(), complexData.end(), imagData.begin(), [](const auto& value) { return value.imag(); });
+
+        analysis_.checkOutput(realData, expectedOut_);
+        analysis_.checkOutput(imagData, expectedOut_);
+    }
+
     BOOST_AUTO_TEST_CASE(welch)
     {
         BOOST_TEST((initialized_ = analysis_.initialize("../../test cases/WinWelchTest.xml", "win.in", workingSet_, "win.out", expectedOut_)), "Loading test data failed.");
@@ -7,4 +7,23 @@
 #include "FixtureBitReversal.cpp"
 #include "FixtureSinCos.cpp"
 #include "FixtureWindowCalculation.cpp"
+#include "FixtureShortTimeFourierTransform.cpp"
+#include "FixtureConvolution.cpp"
+#include "FixtureWelchPowerSpectralDensity.cpp"
+#include "FixtureGoertzel.cpp"
+#include "FixturePrunedFft.cpp"
+#include "FixtureChirpZTransform.cpp"
+#include "FixtureDiscreteCosineTransform.cpp"
+#include "FixtureHilbertTransform.cpp"
+#include "FixtureSpectrum.cpp"
+#include "FixturePeakDetection.cpp"
+#include "FixtureFixedPointFft.cpp"
+#include "FixtureMixedPrecision.cpp"
+#include "FixtureHalfPrecision.cpp"
+#include "FixtureAlgorithmDispatch.cpp"
+#include "FixtureSparseAlgorithmFactory.cpp"
+#include "FixturePlan.cpp"
+#include "FixtureConjugatedBackward.cpp"
+#include "FixtureRuntimeAlgorithm.cpp"
+#include "FixtureAutotuner.cpp"
 #include "FixtureFft.cpp"
\ No newline at end of file
@@ -0,0 +1,5 @@
+#define BOOST_TEST_MODULE jeanbaptiste f16c tests
+#define BOOST_TEST_DYN_LINK
+
+// Built with -mf16c to run the F16C conversion of binary16.
+#include "FixtureHalfPrecision.cpp"
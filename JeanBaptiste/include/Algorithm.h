@@ -3,23 +3,17 @@
 #include "basic/BitReversalIndexSwapping.h"
 #include <boost/hana.hpp>
 #include <cassert>
+#include <complex>
 #include "core/Radix2.h"
 #include "core/Radix4.h"
 #include "core/RadixSplit24.h"
 #include "ExecutableAlgorithm.h"
-#include "normalization/DivisionByLengthNormalization.h"
-#include "normalization/NoNormalization.h"
-#include "normalization/SquareRootNormalization.h"
+#include <memory>
+#include <optional>
 #include "Options.h"
-#include "windowing/BartlettWindow.h"
-#include "windowing/BlackmanHarrisWindow.h"
-#include "windowing/BlackmanWindow.h"
-#include "windowing/CosineWindow.h"
-#include "windowing/FlatTopWindow.h"
-#include "windowing/HammingWindow.h"
-#include "windowing/NoWindow.h"
-#include "windowing/VonHannWindow.h"
-#include "windowing/WelchWindow.h"
+#include "postprocessing/SpectrumSelection.h"
+#include <type_traits>
+#include "windowing/WindowSelection.h"
 
 namespace hana = boost::hana;
 namespace jbo = jeanbaptiste::options;
@@ -27,8 +21,14 @@ namespace jbo = jeanbaptiste::options;
 namespace jeanbaptiste
 {
     /** Defines a tuple of executable sub tasks which belong to a FFT task, e.g. FFT, normalization, bit reversal.
+        The class is final, so that calls on an Algorithm of known type are not dispatched virtually and may be inlined.
         \param Stage ... The count of stages inside an FFT algorithm. E.g. Stages = 4 -> sample count = 2^4
         \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+        \param Spectrum ... Defines the real spectrum which is put out into a separate buffer additionally, e.g. Spectrum_Power.
+                            Spectrum_Complex puts out the complex data only.
+        \param Precision ... Defines the precision of the twiddle factors. Precision_Mixed calculates them in double precision
+                             while the data keeps the precision of Complex, e.g. std::complex<float>.
     */
     template <typename Stage,
               typename Radix,
@@ -36,10 +36,35 @@ namespace jeanbaptiste
               typename Direction,
               typename Window,
               typename Normalization,
-              typename Complex>
-    class Algorithm
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real,
+              typename Spectrum = jbo::Spectrum_Complex,
+              typename Precision = jbo::Precision_Data>
+    class Algorithm final
         : public ExecutableAlgorithm<Complex>
     {
+        using TwiddleComplex = std::conditional_t<std::is_same_v<Precision, jbo::Precision_Mixed>, std::complex<double>, Complex>;
+
+        /** Direction_Backward_Conjugated runs the forward core on conjugated data: x[n] = conj(FFT(conj(X[k]))).
+            Both conjugations are fused into passes over the data which exist anyway. The input is conjugated by the window,
+            or by the bit reversal of DIT if there is no window. The output is conjugated by the bit reversal of DIF or by
+            the normalization of DIT.
+        */
+        static constexpr bool kConjugate_ = std::is_same_v<Direction, jbo::Direction_Backward_Conjugated>;
+        static constexpr bool kDecimationInTime_ = std::is_same_v<Decimation, jbo::Decimation_In_Time>;
+        static constexpr bool kWindowNone_ = std::is_same_v<Window, jbo::Window_None>;
+        static constexpr bool kConjugateInWindow_ = kConjugate_ && !(kDecimationInTime_ && kWindowNone_);
+        static constexpr bool kConjugateInBitReversal_ = kConjugate_ && (!kDecimationInTime_ || kWindowNone_);
+        static constexpr bool kConjugateInNormalization_ = kConjugate_ && kDecimationInTime_;
+
+        static_assert(!(kConjugateInNormalization_ && std::is_same_v<Spectrum, jbo::Spectrum_Phase>),
+            "Trying to put out the phase spectrum of a DIT algorithm of Direction_Backward_Conjugated.");
+
+        using WindowInputType = std::conditional_t<kConjugateInWindow_, jbo::WindowInput_Conjugated<WindowInput>, WindowInput>;
+        using NormalizationType = std::conditional_t<kConjugateInNormalization_, jbo::Normalization_Conjugated<Normalization>,
+            Normalization>;
+        using ConjugateInBitReversal = std::integral_constant<bool, kConjugateInBitReversal_>;
+
         /** Calculates the number of samples that can be processed by this algorithm.
         */
         static constexpr auto getNumberOfSamples(void)
@@ -64,76 +89,36 @@ namespace jeanbaptiste
         static constexpr auto getDirectionValue(void)
         {
             return hana::if_(
-                hana::typeid_(Direction{}) == hana::type<jbo::Direction_Forward>{},
+                hana::typeid_(Direction{}) == hana::type<jbo::Direction_Forward>{} || hana::bool_c<kConjugate_>,
                     std::integral_constant<int, 1>{},
                     std::integral_constant<int, -1>{});
         }
 
-        /** Creates a value of the selected window type at compilation time.
+        /** Creates a value of the selected window type at compilation time. The window covers all samples, i.e. 4^Stage
+            ones of a radix 4 algorithm.
             \return value ... The selected value.
         */
         static constexpr auto getWindowValue(void)
         {
-            return
-                hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Bartlett>{},
-                    windowing::BartlettWindow<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{},
-                hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Blackman>{},
-                    windowing::BlackmanWindow<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{},
-                hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_BlackmanHarris>{},
-                    windowing::BlackmanHarrisWindow<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{},
-                hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Cosine>{},
-                    windowing::CosineWindow<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{},
-                hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_FlatTop>{},
-                    windowing::FlatTopWindow<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{},
-                hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Hamming>{},
-                    windowing::HammingWindow<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{},
-                hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_vonHann>{},
-                    windowing::VonHannWindow<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{},
-                hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Welch>{},
-                    windowing::WelchWindow<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{},
-                    windowing::NoWindow<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{}
-                ))))))));
+            return windowing::selectWindow<
+                Window,
+                decltype(getNumberOfSamples()),
+                Complex,
+                WindowInputType>();
         }
 
-        /** Creates a value of the selected normalization type at compilation time.
+        /** Creates a value of the selected normalization type at compilation time. If a real spectrum is selected the
+            normalization is folded into the spectrum sub task.
             \return value ... The selected value.
         */
         static constexpr auto getRadix2NormalizationValue(void)
         {
-            return
-                hana::if_(hana::typeid_(Normalization{}) == hana::type<jbo::Normalization_Division_By_Length>{},
-                    normalization::DivisionByLengthNormalization<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        typename decltype(std::integral_constant<int, 0>{})::type,
-                        Complex>{},
-                hana::if_(hana::typeid_(Normalization{}) == hana::type<jbo::Normalization_Square_Root>{},
-                    normalization::SquareRootNormalization<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        typename decltype(std::integral_constant<int, 0>{})::type,
-                        Complex>{},
-                    normalization::NoNormalization<
-                        typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                        Complex>{}
-                ));
-         }
+            return postprocessing::selectSpectrum<
+                Spectrum,
+                NormalizationType,
+                typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
+                Complex>();
+        }
 
         /** Creates a tupel of sub task type values belonging to a radix 2 task at compilation time.
             \return hana::tuple_t ... A tuple of sub task type values.
@@ -146,45 +131,39 @@ namespace jeanbaptiste
                         decltype(getWindowValue()),
                         basic::BitReversalIndexSwapping<
                             typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                            Complex>,
+                            Complex,
+                            ConjugateInBitReversal>,
                         core::Radix2DIT<
                             typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
                             typename decltype(getDirectionValue())::type,
-                            Complex>,
+                            Complex,
+                            TwiddleComplex>,
                         decltype(getRadix2NormalizationValue())>,
                     hana::tuple_t<
                         decltype(getWindowValue()),
                         core::Radix2DIF<
                             typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
                             typename decltype(getDirectionValue())::type,
-                            Complex>,
+                            Complex,
+                            TwiddleComplex>,
                         basic::BitReversalIndexSwapping<
                             typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                            Complex>,
+                            Complex,
+                            ConjugateInBitReversal>,
                         decltype(getRadix2NormalizationValue())>);
         }
 
-        /** Creates a value of the selected normalization type at compilation time.
+        /** Creates a value of the selected normalization type at compilation time. If a real spectrum is selected the
+            normalization is folded into the spectrum sub task.
             \return value ... The selected value.
         */
         static constexpr auto getRadix4NormalizationValue(void)
         {
-            return
-                hana::if_(hana::typeid_(Normalization{}) == hana::type<jbo::Normalization_Division_By_Length>{},
-                    normalization::DivisionByLengthNormalization<
-                        typename decltype(std::integral_constant<int, 1 << (Stage::value << 1)>{})::type,
-                        typename decltype(std::integral_constant<int, 0>{})::type,
-                        Complex>{},
-                hana::if_(hana::typeid_(Normalization{}) == hana::type<jbo::Normalization_Square_Root>{},
-                    normalization::SquareRootNormalization<
-                        typename decltype(std::integral_constant<int, 1 << (Stage::value << 1)>{})::type,
-                        typename decltype(std::integral_constant<int, 0>{})::type,
-                        Complex>{},
-                    normalization::NoNormalization<
-                        typename decltype(std::integral_constant<int, 1 << (Stage::value << 1)>{})::type,
-                        Complex>{}
-                ));
- 
+            return postprocessing::selectSpectrum<
+                Spectrum,
+                NormalizationType,
+                typename decltype(std::integral_constant<int, 1 << (Stage::value << 1)>{})::type,
+                Complex>();
         }
 
         /** Creates a tupel of sub task type values belonging to a radix 4 task at compilation time.
@@ -198,21 +177,25 @@ namespace jeanbaptiste
                         decltype(getWindowValue()),
                         basic::BitReversalIndexSwapping<
                             typename decltype(std::integral_constant<int, 1 << (Stage::value << 1)>{})::type,
-                            Complex>,
+                            Complex,
+                            ConjugateInBitReversal>,
                         core::Radix4DIT<
                             typename decltype(std::integral_constant<int, 1 << (Stage::value << 1)>{})::type,
                             typename decltype(getDirectionValue())::type,
-                            Complex>,
+                            Complex,
+                            TwiddleComplex>,
                         decltype(getRadix4NormalizationValue())>,
                     hana::tuple_t<
                         decltype(getWindowValue()),
                         core::Radix4DIF<
                             typename decltype(std::integral_constant<int, 1 << (Stage::value << 1)>{})::type,
                             typename decltype(getDirectionValue())::type,
-                            Complex>,
+                            Complex,
+                            TwiddleComplex>,
                         basic::BitReversalIndexSwapping<
                             typename decltype(std::integral_constant<int, 1 << (Stage::value << 1)>{})::type,
-                            Complex>,
+                            Complex,
+                            ConjugateInBitReversal>,
                         decltype(getRadix4NormalizationValue())>);
         }
 
@@ -227,21 +210,25 @@ namespace jeanbaptiste
                         decltype(getWindowValue()),
                         basic::BitReversalIndexSwapping<
                             typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                            Complex>,
+                            Complex,
+                            ConjugateInBitReversal>,
                         core::RadixSplit24DIT<
                             typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
                             typename decltype(getDirectionValue())::type,
-                            Complex>,
+                            Complex,
+                            TwiddleComplex>,
                         decltype(getRadix2NormalizationValue())>,
                     hana::tuple_t<
                         decltype(getWindowValue()),
                         core::RadixSplit24DIF<
                             typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
                             typename decltype(getDirectionValue())::type,
-                            Complex>,
+                            Complex,
+                            TwiddleComplex>,
                         basic::BitReversalIndexSwapping<
                             typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type,
-                            Complex>,
+                            Complex,
+                            ConjugateInBitReversal>,
                         decltype(getRadix2NormalizationValue())>);
         }
 
@@ -274,6 +261,52 @@ namespace jeanbaptiste
             });
         }
 
+        /** Executes all sub tasks sequentially. The last one puts out the selected real spectrum of numberOfFrequencies() bins.
+            The complex data is not normalized then.
+            \param[in] data ... Pointer to an array of SampleCnt elements of type Complex.
+            \param[out] spectrum ... Pointer to an array of numberOfFrequencies() real values.
+            \return bool ... False for Spectrum_Complex and Spectrum_Peaks, which put out no real spectrum.
+        */
+        bool calculateSpectrum(Complex* data, typename Complex::value_type* spectrum) const override
+        {
+            if constexpr (hana::typeid_(Spectrum{}) == hana::type<jbo::Spectrum_Complex>{}
+                || postprocessing::IsSpectrumPeaks<Spectrum>::value)
+                return false;
+            else
+            {
+                hana::for_each(hana::drop_back(tupleOfSubTasks_), [&](const auto& subTask)
+                {
+                    subTask(data);
+                });
+
+                hana::back(tupleOfSubTasks_)(data, spectrum);
+
+                return true;
+            }
+        }
+
+        /** Executes all sub tasks sequentially. The last one finds the strongest peaks within numberOfFrequencies() bins.
+            The complex data is not normalized then.
+            \param[in] data ... Pointer to an array of SampleCnt elements of type Complex.
+            \param[out] peaks ... Pointer to an array of PeakCnt peaks of Spectrum_Peaks.
+            \return std::optional ... The count of peaks found. Empty for other spectra than Spectrum_Peaks.
+        */
+        std::optional<std::size_t> findPeaks(Complex* data, postprocessing::Peak<typename Complex::value_type>* peaks) const
+            override
+        {
+            if constexpr (!postprocessing::IsSpectrumPeaks<Spectrum>::value)
+                return std::nullopt;
+            else
+            {
+                hana::for_each(hana::drop_back(tupleOfSubTasks_), [&](const auto& subTask)
+                {
+                    subTask(data);
+                });
+
+                return hana::back(tupleOfSubTasks_)(data, peaks);
+            }
+        }
+
         std::size_t numberOfSamples(void) const override
         {
             return getNumberOfSamples();
@@ -284,4 +317,20 @@ namespace jeanbaptiste
             return getNumberOfFrequencies();
         }
     };
-}
\ No newline at end of file
+
+    /** Creates an FFT algorithm behind its dynamic interface. The factories create their algorithms by it, so that a
+        translation unit declaring the creator as extern template (see AlgorithmInstantiation.h) instantiates neither the
+        algorithm class nor its sub tasks and tables.
+        \param AlgorithmType ... The FFT algorithm, e.g. Algorithm<...>.
+        \param Complex ... The complex data type.
+        \return std::unique_ptr ... Pointer to the FFT algorithm.
+    */
+    template <typename AlgorithmType, typename Complex>
+    std::unique_ptr<ExecutableAlgorithm<Complex>> createAlgorithm(void)
+    {
+        return std::make_unique<AlgorithmType>();
+    }
+}
+
+// Common configurations are instantiated once by the library jeanbaptiste_instantiations and may be declared extern.
+#include "AlgorithmInstantiation.h"
@@ -1,33 +1,77 @@
 #pragma once
 
+#include <algorithm>
 #include "Algorithm.h"
+#include <array>
 #include <boost/hana.hpp>
 #include <cassert>
-#include <functional>
 #include <iostream>
 #include <memory>
+#include "OptionKinds.h"
+#include "RuntimeAlgorithm.h"
+#include <type_traits>
+#include <utility>
+#include <variant>
 #include "SubTask.h"
-#include <unordered_map>
 
 namespace hana = boost::hana;
 
 namespace jeanbaptiste
 {
-    /** A factory for FFT algorithms of different stage. Each stage is used for a certain count of data samples.
-        \param Begin ... The starting index of supported FFT algorithm stages.
-        \param End ... The end index of supported FFT algorithm stages.
+    /** A factory for FFT algorithms of an explicit set of stages. Only the listed stages are instantiated, e.g. the stages 6
+        and 12 without all stages in between, which trims compile time, binary size and static memory (window and bit reversal
+        tables) to the transform lengths actually used.
+        \param Stages ... The stages of the supported FFT algorithms in ascending order, e.g. std::index_sequence<6, 10, 12>.
         \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+        \param Spectrum ... Defines the real spectrum which is put out into a separate buffer additionally, e.g. Spectrum_Power.
+        \param Precision ... Defines the precision of the twiddle factors: Precision_Data or Precision_Mixed (double).
     */
-    template <std::size_t Begin,
-              std::size_t End,
+    template <typename Stages,
               typename Radix,
               typename Decimation,
               typename Direction,
               typename Window,
               typename Normalization,
-              typename Complex>
-    class AlgorithmFactory
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real,
+              typename Spectrum = jbo::Spectrum_Complex,
+              typename Precision = jbo::Precision_Data>
+    class SparseAlgorithmFactory;
+
+    template <std::size_t... Stages,
+              typename Radix,
+              typename Decimation,
+              typename Direction,
+              typename Window,
+              typename Normalization,
+              typename Complex,
+              typename WindowInput,
+              typename Spectrum,
+              typename Precision>
+    class SparseAlgorithmFactory<std::index_sequence<Stages...>, Radix, Decimation, Direction, Window, Normalization, Complex,
+                                 WindowInput, Spectrum, Precision>
     {
+        static_assert(sizeof...(Stages) > 0, "Trying to create a factory without stages.");
+
+        /** Checks whether the stages are in strictly ascending order, so that each stage is unique.
+        */
+        static constexpr bool isAscending(void)
+        {
+            constexpr std::size_t stages[] = {Stages...};
+
+            for (std::size_t i = 1; i < sizeof...(Stages); ++i)
+                if (stages[i - 1] >= stages[i])
+                    return false;
+
+            return true;
+        }
+
+        static_assert(isAscending(), "The stages of a factory have to be in ascending order.");
+
+        static constexpr std::size_t kFirstStage_ = std::min({Stages...});
+        static constexpr std::size_t kLastStage_ = std::max({Stages...});
+
         /** Create a map of FFT algorithm stages at compile time.
             The key of a map element is the stage of an FFT algorithm - used as its ID.
             The value of a map element is the FFT algorithm which contains a tuple of sub tasks.
@@ -35,51 +79,192 @@ namespace jeanbaptiste
         */
         static constexpr auto createMapOfAlgorithms(void)
         {
-            auto stages = hana::make_range(hana::int_c<Begin>, hana::int_c<End>);
-
-            return hana::unpack(stages, [](auto... stage)
-            {
-                return hana::make_map(hana::make_pair(stage, hana::template_<Algorithm>(stage, hana::type_c<Radix>,
-                    hana::type_c<Decimation>, hana::type_c<Direction>, hana::type_c<Window>, hana::type_c<Normalization>,
-                    hana::type_c<Complex>))...);
-            });
+            return hana::make_map(hana::make_pair(hana::int_c<Stages>, hana::template_<Algorithm>(hana::int_c<Stages>,
+                hana::type_c<Radix>, hana::type_c<Decimation>, hana::type_c<Direction>, hana::type_c<Window>,
+                hana::type_c<Normalization>, hana::type_c<Complex>, hana::type_c<WindowInput>, hana::type_c<Spectrum>,
+                hana::type_c<Precision>))...);
         }
 
         static constexpr auto algorithmMap_ = createMapOfAlgorithms();
 
-        using Callback = std::function<std::unique_ptr<ExecutableAlgorithm<Complex>>()>;
-        std::unordered_map<std::size_t, Callback> dynamicAlgorithmMap_;
+    public:
+        /** The FFT algorithm of a stage known at compilation time.
+        */
+        template <std::size_t Stage>
+        using AlgorithmOfStage = typename decltype(+algorithmMap_[hana::int_c<Stage>])::type;
+
+        /** Holds the FFT algorithm of a stage selected at runtime by value. See execute().
+        */
+        using AlgorithmVariant = std::variant<AlgorithmOfStage<Stages>...>;
+
+    private:
+        using Creator = std::unique_ptr<ExecutableAlgorithm<Complex>> (*)(void);
+        using VariantCreator = AlgorithmVariant (*)(void);
+
+        template <typename AlgorithmType>
+        static AlgorithmVariant createAlgorithmVariant(void)
+        {
+            return AlgorithmVariant(std::in_place_type<AlgorithmType>);
+        }
+
+        // A single immutable instance per algorithm type. Algorithms are stateless, so the instances may be shared.
+        template <typename AlgorithmType>
+        static inline const AlgorithmType algorithmInstance_{};
+
+        /** Creates a table indexed by stage - kFirstStage_ at compilation time. Entries of stages not listed are nullptr.
+            \param Entry ... Returns the entry of a stage's algorithm type.
+            \return std::array ... The entry of each stage.
+        */
+        template <typename Element, typename Entry>
+        static constexpr auto createTable(Entry entry)
+        {
+            std::array<Element, kLastStage_ - kFirstStage_ + 1> table{};
+            ((table[Stages - kFirstStage_] = entry(hana::type_c<AlgorithmOfStage<Stages>>)), ...);
+
+            return table;
+        }
+
+        static constexpr auto creatorTable_ = createTable<Creator>([](auto algorithm) -> Creator
+        {
+            return &jeanbaptiste::createAlgorithm<typename decltype(algorithm)::type, Complex>;
+        });
+
+        // RuntimeAlgorithm puts out the complex data only.
+        static constexpr bool kFallbackSupported_ = std::is_same_v<Spectrum, jbo::Spectrum_Complex>;
+
+        /** Checks whether the stage is one of Stages.
+        */
+        static bool isSupported(const std::size_t stage)
+        {
+            return stage >= kFirstStage_ && stage <= kLastStage_ && creatorTable_[stage - kFirstStage_] != nullptr;
+        }
 
     public:
-        /** Creates a runtime map containing concrete FFT algorithm initializations.
+        /** Creates a pointer to an FFT algorithm instantiation. For a stage which is not one of Stages, a RuntimeAlgorithm
+            of the same options is created instead, if the factory puts out complex data (Spectrum_Complex). The
+            RuntimeAlgorithm ignores Decimation and always runs decimation in time passes, which yields the same result.
+            \param[in] stage ... The stage of the FFT algorithm which is to be returned.
+            \param[out] fallback ... Optional. Set to true, if a RuntimeAlgorithm is returned, otherwise false.
+            \return std::unique_ptr ... Pointer to the FFT algorithm instantiation.
+            \exception std::length_error ... The sample count of a fallback stage exceeds the largest supported length.
         */
-        AlgorithmFactory(void)
+        std::unique_ptr<ExecutableAlgorithm<Complex>> getAlgorithm(const std::size_t stage, bool* fallback = nullptr) const
         {
-            // Create a runtime map of executable algorithms.
-            hana::for_each(algorithmMap_, [&](const auto constantPair)
+            const bool supported = isSupported(stage);
+
+            if (fallback)
+                *fallback = !supported;
+
+            if constexpr (kFallbackSupported_)
             {
-                dynamicAlgorithmMap_.insert(
+                if (!supported)
                 {
-                    decltype(+hana::first(constantPair))::value,
-                    [&]() -> std::unique_ptr<ExecutableAlgorithm<Complex>>
-                    {
-                        using AlgorithmType = typename decltype(+hana::second(constantPair))::type;
-                        return std::make_unique<AlgorithmType>();
-                    }
-                });
+                    const auto sampleCnt = RuntimeAlgorithm<Complex, WindowInput>::template getSampleCount<Radix>(stage);
+
+                    return std::make_unique<RuntimeAlgorithm<Complex, WindowInput>>(sampleCnt, jbo::toWindowKind<Window>(),
+                        jbo::toNormalizationKind<Normalization>(), jbo::toDirectionKind<Direction>());
+                }
+            }
+
+            assert(supported && "Trying to find algorithm of unknown stage.");
+
+            return creatorTable_[stage - kFirstStage_]();
+        }
+
+        /** Returns a preconstructed FFT algorithm without allocation. The instance is shared by all factories of this type
+            and lives until the end of the program.
+            \param[in] stage ... The stage of the FFT algorithm which is to be returned.
+            \return ExecutableAlgorithm ... Reference to the immutable FFT algorithm instance.
+        */
+        const ExecutableAlgorithm<Complex>& getAlgorithmInstance(const std::size_t stage) const
+        {
+            assert(isSupported(stage) && "Trying to find algorithm of unknown stage.");
+
+            // Local, so that the algorithm classes are instantiated only if this is used (see AlgorithmInstantiation.h).
+            static constexpr auto instanceTable = createTable<const ExecutableAlgorithm<Complex>*>([](auto algorithm)
+                -> const ExecutableAlgorithm<Complex>*
+            {
+                return &algorithmInstance_<typename decltype(algorithm)::type>;
             });
+
+            return *instanceTable[stage - kFirstStage_];
         }
 
-        /** Creates a pointer to an FFT algorithm instantiation.
+        /** Returns the preconstructed FFT algorithm of a stage known at compilation time by its concrete type,
+            so that its sub tasks may be inlined into the caller.
+            \param Stage ... The stage of the FFT algorithm which is to be returned.
+            \return AlgorithmOfStage<Stage> ... Reference to the immutable FFT algorithm instance.
+        */
+        template <std::size_t Stage>
+        const AlgorithmOfStage<Stage>& getAlgorithmInstance(void) const
+        {
+            static_assert(((Stage == Stages) || ...), "Trying to find algorithm of unknown stage.");
+
+            return algorithmInstance_<AlgorithmOfStage<Stage>>;
+        }
+
+        /** Creates an FFT algorithm held by value in a std::variant, which is executed without virtual dispatch.
             \param[in] stage ... The stage of the FFT algorithm which is to be returned.
-            \return std::unique_ptr ... Pointer to the FFT algorithm instantiation.
+            \return AlgorithmVariant ... The FFT algorithm instantiation.
         */
-        std::unique_ptr<ExecutableAlgorithm<Complex>> getAlgorithm(const std::size_t stage)
+        AlgorithmVariant getAlgorithmVariant(const std::size_t stage) const
         {
-            auto callback = dynamicAlgorithmMap_.find(stage);
-            assert(callback != dynamicAlgorithmMap_.end() && "Trying to find algorithm of unknown stage.");
+            assert(isSupported(stage) && "Trying to find algorithm of unknown stage.");
+
+            // Local, so that the algorithm classes are instantiated only if this is used (see AlgorithmInstantiation.h).
+            static constexpr auto variantCreatorTable = createTable<VariantCreator>([](auto algorithm) -> VariantCreator
+            {
+                return &createAlgorithmVariant<typename decltype(algorithm)::type>;
+            });
 
-            return callback->second();
+            return variantCreatorTable[stage - kFirstStage_]();
+        }
+
+        /** Executes the FFT algorithm held by a variant. The alternative is selected by std::visit, and the call on the
+            concrete (final) algorithm type is not dispatched virtually.
+            \param[in] algorithm ... The FFT algorithm created by getAlgorithmVariant().
+            \param[in, out] data ... Pointer to an array of numberOfSamples() elements of type Complex.
+        */
+        static void execute(const AlgorithmVariant& algorithm, Complex* data)
+        {
+            std::visit([data](const auto& selectedAlgorithm)
+            {
+                selectedAlgorithm(data);
+            }, algorithm);
         }
     };
+
+    namespace internal
+    {
+        template <std::size_t Begin, std::size_t... Indices>
+        constexpr auto makeStageRange(std::index_sequence<Indices...>)
+        {
+            return std::index_sequence<(Begin + Indices)...>{};
+        }
+    }
+
+    /** A factory for FFT algorithms of different stage. Each stage is used for a certain count of data samples.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+        \param Spectrum ... Defines the real spectrum which is put out into a separate buffer additionally, e.g. Spectrum_Power.
+        \param Precision ... Defines the precision of the twiddle factors: Precision_Data or Precision_Mixed (double).
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Direction,
+              typename Window,
+              typename Normalization,
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real,
+              typename Spectrum = jbo::Spectrum_Complex,
+              typename Precision = jbo::Precision_Data>
+    class AlgorithmFactory
+        : public SparseAlgorithmFactory<decltype(internal::makeStageRange<Begin>(std::make_index_sequence<End - Begin>{})),
+                                        Radix, Decimation, Direction, Window, Normalization, Complex, WindowInput, Spectrum,
+                                        Precision>
+    {};
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Algorithm.h"
+#include <boost/hana.hpp>
+#include <complex>
+#include <memory>
+#include "Options.h"
+
+/** Explicit instantiations of common FFT algorithm configurations.
+    The library target jeanbaptiste_instantiations instantiates the creators createAlgorithm of these configurations once
+    (explicit instantiation definitions), which instantiates the algorithms with all their virtual member functions.
+    Translation units linked against it may declare the creators as extern templates:
+    - JEANBAPTISTE_EXTERN_RADIX_2_DOUBLE, JEANBAPTISTE_EXTERN_RADIX_2_FLOAT, JEANBAPTISTE_EXTERN_RADIX_4_DOUBLE,
+      JEANBAPTISTE_EXTERN_RADIX_4_FLOAT, JEANBAPTISTE_EXTERN_RADIX_SPLIT_2_4_DOUBLE, JEANBAPTISTE_EXTERN_RADIX_SPLIT_2_4_FLOAT
+      declare the configurations of one radix and complex type.
+    - JEANBAPTISTE_EXTERN_TEMPLATES declares all of them.
+    AlgorithmFactory::getAlgorithm creates its algorithms by createAlgorithm only, so such a translation unit instantiates
+    neither the algorithm classes nor their sub tasks, recursions and tables. Typed access (getAlgorithmInstance,
+    getAlgorithmVariant, AlgorithmOfStage) still instantiates the algorithms in the translation unit.
+    The library is compiled with -ffunction-sections, so linking with --gc-sections drops the unused configurations.
+    Configurations (decimation in time, no window):
+    - Complex: std::complex<double>, std::complex<float>
+    - Radix: Radix_2, Radix_Split_2_4 with stages 1 ... 12, Radix_4 with stages 1 ... 6 (up to 4096 samples)
+    - Direction_Forward with Normalization_No, Direction_Backward with Normalization_Division_By_Length
+    Any AlgorithmFactory of such a configuration uses them for the stages listed.
+*/
+
+#define JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, Stage, Radix, Direction, Normalization, Complex) \
+    Prefix template std::unique_ptr<jeanbaptiste::ExecutableAlgorithm<Complex>> jeanbaptiste::createAlgorithm< \
+        jeanbaptiste::Algorithm<boost::hana::int_<Stage>, jeanbaptiste::options::Radix, \
+        jeanbaptiste::options::Decimation_In_Time, jeanbaptiste::options::Direction, jeanbaptiste::options::Window_None, \
+        jeanbaptiste::options::Normalization, Complex>, Complex>(void);
+
+#define JEANBAPTISTE_INSTANTIATE_STAGES_1_TO_6(Prefix, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 1, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 2, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 3, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 4, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 5, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 6, Radix, Direction, Normalization, Complex)
+
+#define JEANBAPTISTE_INSTANTIATE_STAGES_1_TO_12(Prefix, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_STAGES_1_TO_6(Prefix, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 7, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 8, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 9, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 10, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 11, Radix, Direction, Normalization, Complex) \
+    JEANBAPTISTE_INSTANTIATE_ALGORITHM(Prefix, 12, Radix, Direction, Normalization, Complex)
+
+/** Instantiates the forward and backward algorithms of Radix_2 or Radix_Split_2_4.
+*/
+#define JEANBAPTISTE_INSTANTIATE_RADIX_2_CONFIGURATIONS(Prefix, Radix, Complex) \
+    JEANBAPTISTE_INSTANTIATE_STAGES_1_TO_12(Prefix, Radix, Direction_Forward, Normalization_No, Complex) \
+    JEANBAPTISTE_INSTANTIATE_STAGES_1_TO_12(Prefix, Radix, Direction_Backward, Normalization_Division_By_Length, Complex)
+
+/** Instantiates the forward and backward algorithms of Radix_4.
+*/
+#define JEANBAPTISTE_INSTANTIATE_RADIX_4_CONFIGURATIONS(Prefix, Complex) \
+    JEANBAPTISTE_INSTANTIATE_STAGES_1_TO_6(Prefix, Radix_4, Direction_Forward, Normalization_No, Complex) \
+    JEANBAPTISTE_INSTANTIATE_STAGES_1_TO_6(Prefix, Radix_4, Direction_Backward, Normalization_Division_By_Length, Complex)
+
+#if defined(JEANBAPTISTE_EXTERN_TEMPLATES) || defined(JEANBAPTISTE_EXTERN_RADIX_2_DOUBLE)
+JEANBAPTISTE_INSTANTIATE_RADIX_2_CONFIGURATIONS(extern, Radix_2, std::complex<double>)
+#endif
+#if defined(JEANBAPTISTE_EXTERN_TEMPLATES) || defined(JEANBAPTISTE_EXTERN_RADIX_2_FLOAT)
+JEANBAPTISTE_INSTANTIATE_RADIX_2_CONFIGURATIONS(extern, Radix_2, std::complex<float>)
+#endif
+#if defined(JEANBAPTISTE_EXTERN_TEMPLATES) || defined(JEANBAPTISTE_EXTERN_RADIX_SPLIT_2_4_DOUBLE)
+JEANBAPTISTE_INSTANTIATE_RADIX_2_CONFIGURATIONS(extern, Radix_Split_2_4, std::complex<double>)
+#endif
+#if defined(JEANBAPTISTE_EXTERN_TEMPLATES) || defined(JEANBAPTISTE_EXTERN_RADIX_SPLIT_2_4_FLOAT)
+JEANBAPTISTE_INSTANTIATE_RADIX_2_CONFIGURATIONS(extern, Radix_Split_2_4, std::complex<float>)
+#endif
+#if defined(JEANBAPTISTE_EXTERN_TEMPLATES) || defined(JEANBAPTISTE_EXTERN_RADIX_4_DOUBLE)
+JEANBAPTISTE_INSTANTIATE_RADIX_4_CONFIGURATIONS(extern, std::complex<double>)
+#endif
+#if defined(JEANBAPTISTE_EXTERN_TEMPLATES) || defined(JEANBAPTISTE_EXTERN_RADIX_4_FLOAT)
+JEANBAPTISTE_INSTANTIATE_RADIX_4_CONFIGURATIONS(extern, std::complex<float>)
+#endif
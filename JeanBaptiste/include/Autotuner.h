@@ -0,0 +1,359 @@
+#pragma once
+
+#include <array>
+#include <boost/hana.hpp>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include "ExecutableAlgorithm.h"
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "OptionKinds.h"
+#include "Options.h"
+#include "PlanFactory.h"
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** A plan factory which selects the fastest radix and decimation per transform length on the current machine.
+        On the first request of a stage every compiled variant (radix 2, radix 4 for an even stage and split radix 2/4, each
+        DIT and DIF) is timed and the fastest one is remembered as wisdom. If a wisdom file is given, it is loaded on
+        construction and rewritten after each measurement, so that later processes skip the measurement.
+        The stage is the one of radix 2, i.e. the sample count is 2^stage for all variants. Stages outside of [Begin, End) are
+        not measured and fall back to a RuntimeAlgorithm as in PlanFactory.
+        \param Begin ... The starting index of supported stages.
+        \param End ... The end index of supported stages.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
+    class Autotuner
+    {
+    public:
+        struct Variant
+        {
+            jbo::RadixKind radix;
+            jbo::DecimationKind decimation;
+        };
+
+    private:
+        using ValueType = typename Complex::value_type;
+        // Wisdom of a stage and a value size, so that one file serves float and double tuners.
+        using WisdomKey = std::pair<std::size_t, std::size_t>;
+
+        template <typename Radix, typename Decimation>
+        using FactoryType = std::conditional_t<std::is_same_v<Radix, jbo::Radix_4>,
+            PlanFactory<((Begin + 1) >> 1), ((End + 1) >> 1), Radix, Decimation, Complex, WindowInput>,
+            PlanFactory<Begin, End, Radix, Decimation, Complex, WindowInput>>;
+
+        struct Entry
+        {
+            std::unique_ptr<ExecutableAlgorithm<Complex>> (*create)(std::size_t, jbo::WindowKind, jbo::NormalizationKind,
+                jbo::DirectionKind, bool*);
+            const ExecutableAlgorithm<Complex>& (*getInstance)(std::size_t, jbo::WindowKind, jbo::NormalizationKind,
+                jbo::DirectionKind, bool*);
+        };
+
+        template <typename Radix>
+        static constexpr std::size_t toFactoryStage(const std::size_t stage)
+        {
+            return std::is_same_v<Radix, jbo::Radix_4> ? stage >> 1 : stage;
+        }
+
+        template <typename Radix, typename Decimation>
+        static std::unique_ptr<ExecutableAlgorithm<Complex>> createPlan(const std::size_t stage, const jbo::WindowKind window,
+            const jbo::NormalizationKind normalization, const jbo::DirectionKind direction, bool* fallback)
+        {
+            return FactoryType<Radix, Decimation>{}.getAlgorithm(toFactoryStage<Radix>(stage), window, normalization, direction,
+                fallback);
+        }
+
+        template <typename Radix, typename Decimation>
+        static const ExecutableAlgorithm<Complex>& getPlanInstance(const std::size_t stage, const jbo::WindowKind window,
+            const jbo::NormalizationKind normalization, const jbo::DirectionKind direction, bool* fallback)
+        {
+            return FactoryType<Radix, Decimation>{}.getAlgorithmInstance(toFactoryStage<Radix>(stage), window, normalization,
+                direction, fallback);
+        }
+
+        /** Creates the plan functions of a radix indexed by jbo::DecimationKind at compilation time.
+            \return std::array ... The plan functions of each decimation.
+        */
+        template <typename Radix>
+        static constexpr auto createEntryRow(void)
+        {
+            return hana::unpack(jbo::kDecimationOptions, [](auto... decimationOption)
+            {
+                return std::array<Entry, sizeof...(decimationOption)>
+                {
+                    Entry{&createPlan<Radix, typename decltype(decimationOption)::type>,
+                          &getPlanInstance<Radix, typename decltype(decimationOption)::type>}...
+                };
+            });
+        }
+
+        /** Creates a table of the plan functions indexed by jbo::RadixKind and jbo::DecimationKind at compilation time.
+            \return std::array ... The plan functions of each variant.
+        */
+        static constexpr auto createEntryTable(void)
+        {
+            return hana::unpack(jbo::kRadixOptions, [](auto... radixOption)
+            {
+                return std::array<decltype(createEntryRow<jbo::Radix_2>()), sizeof...(radixOption)>
+                {
+                    createEntryRow<typename decltype(radixOption)::type>()...
+                };
+            });
+        }
+
+        static constexpr auto entryTable_ = createEntryTable();
+
+        static const Entry& getEntry(const Variant variant)
+        {
+            return entryTable_[static_cast<std::size_t>(variant.radix)][static_cast<std::size_t>(variant.decimation)];
+        }
+
+        static bool isSupported(const std::size_t stage)
+        {
+            return stage >= Begin && stage < End;
+        }
+
+        /** Checks whether a variant exists for a stage. Radix 4 covers even stages of radix 2 only.
+        */
+        static bool isValid(const std::size_t stage, const Variant variant)
+        {
+            return variant.radix != jbo::RadixKind::Radix_4 || !(stage & 1);
+        }
+
+        /** Times all variants of a stage without window and normalization, which are the same for all of them.
+            Each variant runs once to warm up, then the fastest of repetitions_ batches of runs counts. Copying the input
+            into the work buffer is part of each run, it costs the same for all variants.
+            \return Variant ... The fastest variant.
+        */
+        Variant measure(const std::size_t stage) const
+        {
+            const std::size_t sampleCnt = std::size_t{1} << stage;
+            const std::size_t runCnt = sampleCnt < kBatchSampleCnt_ ? kBatchSampleCnt_ / sampleCnt : 1;
+
+            std::vector<Complex> signal(sampleCnt);
+            std::vector<Complex> data(sampleCnt);
+
+            for (std::size_t i = 0; i < sampleCnt; ++i)
+                signal[i] = Complex(static_cast<ValueType>(std::sin(0.3 * i)), static_cast<ValueType>(std::cos(1.1 * i)));
+
+            Variant fastest{jbo::RadixKind::Radix_2, jbo::DecimationKind::In_Time};
+            auto fastestDuration = std::chrono::steady_clock::duration::max();
+
+            for (std::size_t radix = 0; radix < entryTable_.size(); ++radix)
+            {
+                for (std::size_t decimation = 0; decimation < entryTable_[radix].size(); ++decimation)
+                {
+                    const Variant variant{static_cast<jbo::RadixKind>(radix), static_cast<jbo::DecimationKind>(decimation)};
+
+                    if (!isValid(stage, variant))
+                        continue;
+
+                    auto plan = getEntry(variant).create(stage, jbo::WindowKind::None, jbo::NormalizationKind::No,
+                        jbo::DirectionKind::Forward, nullptr);
+
+                    data = signal;
+                    (*plan)(&data[0]);
+
+                    for (std::size_t repetition = 0; repetition < repetitions_; ++repetition)
+                    {
+                        const auto start = std::chrono::steady_clock::now();
+
+                        for (std::size_t run = 0; run < runCnt; ++run)
+                        {
+                            data = signal;
+                            (*plan)(&data[0]);
+                        }
+
+                        const auto duration = std::chrono::steady_clock::now() - start;
+
+                        if (duration < fastestDuration)
+                        {
+                            fastestDuration = duration;
+                            fastest = variant;
+                        }
+                    }
+                }
+            }
+
+            return fastest;
+        }
+
+        /** Reads all entries of the wisdom file, including the ones of other value sizes. Reading stops at the first
+            malformed entry.
+        */
+        void loadWisdom(void)
+        {
+            std::ifstream file(wisdomPath_);
+            std::string line;
+
+            while (std::getline(file, line))
+            {
+                if (line.empty() || line[0] == '#')
+                    continue;
+
+                std::size_t stage, valueSize, radix, decimation;
+
+                if (std::sscanf(line.c_str(), "%zu %zu %zu %zu", &stage, &valueSize, &radix, &decimation) != 4
+                    || radix >= entryTable_.size() || decimation >= entryTable_[radix].size())
+                    break;
+
+                wisdom_[WisdomKey(stage, valueSize)] = Variant{static_cast<jbo::RadixKind>(radix),
+                    static_cast<jbo::DecimationKind>(decimation)};
+            }
+        }
+
+        /** Replaces the wisdom file by writing a temporary file and renaming it.
+            \return bool ... True, if the file has been written.
+        */
+        bool saveWisdom(void) const
+        {
+            const std::string temporaryPath = wisdomPath_ + ".tmp";
+
+            {
+                std::ofstream file(temporaryPath, std::ios::trunc);
+                file << "# JeanBaptiste wisdom: stage, value size, radix, decimation\n";
+
+                for (const auto& entry : wisdom_)
+                {
+                    file << entry.first.first << ' ' << entry.first.second << ' '
+                         << static_cast<std::size_t>(entry.second.radix) << ' '
+                         << static_cast<std::size_t>(entry.second.decimation) << '\n';
+                }
+
+                if (!file.flush())
+                    return false;
+            }
+
+            return std::rename(temporaryPath.c_str(), wisdomPath_.c_str()) == 0;
+        }
+
+        // Small transforms run in batches of this many samples, so that a batch is long enough to be timed.
+        static constexpr std::size_t kBatchSampleCnt_ = 1 << 14;
+
+        std::string wisdomPath_;
+        std::size_t repetitions_;
+        std::map<WisdomKey, Variant> wisdom_;
+        bool wisdomSaved_ = true;
+        mutable std::mutex mutex_;
+
+    public:
+        /** Loads the wisdom file, if there is one.
+            \param[in] wisdomPath ... Path of the wisdom file. If empty, the wisdom is kept in memory only.
+            \param[in] repetitions ... The count of timed batches per variant.
+        */
+        explicit Autotuner(const std::string& wisdomPath = std::string(), const std::size_t repetitions = 5)
+            : wisdomPath_(wisdomPath)
+            , repetitions_(repetitions)
+        {
+            assert(repetitions > 0 && "Trying to time variants without repetitions.");
+
+            if (!wisdomPath_.empty())
+                loadWisdom();
+        }
+
+        /** Returns the fastest variant of a stage. Without valid wisdom of the stage, all variants are measured and the
+            wisdom file is updated, see isWisdomSaved(). Safe to be called from multiple threads.
+            \param[in] stage ... The stage within [Begin, End).
+            \return Variant ... The fastest variant.
+        */
+        Variant tune(const std::size_t stage)
+        {
+            assert(isSupported(stage) && "Trying to tune a stage outside of the compiled range.");
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            const WisdomKey key(stage, sizeof(ValueType));
+            auto wisdom = wisdom_.find(key);
+
+            // Wisdom of another build may name a variant which does not exist for the stage.
+            if (wisdom != wisdom_.end() && isValid(stage, wisdom->second))
+                return wisdom->second;
+
+            const Variant variant = measure(stage);
+            wisdom_[key] = variant;
+
+            if (!wisdomPath_.empty())
+                wisdomSaved_ = saveWisdom();
+
+            return variant;
+        }
+
+        /** Checks whether the variant of a stage is known without measurement, i.e. whether tune() uses the wisdom.
+        */
+        bool hasWisdom(const std::size_t stage) const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto wisdom = wisdom_.find(WisdomKey(stage, sizeof(ValueType)));
+
+            return wisdom != wisdom_.end() && isValid(stage, wisdom->second);
+        }
+
+        /** Checks whether the wisdom file has been written after the last measurement. If it could not be written, the
+            wisdom is kept in memory only until the next measurement writes the file again.
+            \return bool ... False, if writing the wisdom file failed, otherwise true.
+        */
+        bool isWisdomSaved(void) const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            return wisdomSaved_;
+        }
+
+        /** Creates an FFT plan of the fastest variant. For a stage outside of [Begin, End) a RuntimeAlgorithm is created.
+            \param[in] stage ... The stage of the FFT plan which is to be returned, i.e. 2^stage samples.
+            \param[in] window ... The window applied before the FFT.
+            \param[in] normalization ... The normalization applied after the FFT.
+            \param[in] direction ... The direction of the FFT.
+            \param[out] fallback ... Optional. Set to true, if a RuntimeAlgorithm is returned, otherwise false.
+            \return std::unique_ptr ... Pointer to the FFT plan.
+        */
+        std::unique_ptr<ExecutableAlgorithm<Complex>> getAlgorithm(const std::size_t stage,
+            const jbo::WindowKind window = jbo::WindowKind::None,
+            const jbo::NormalizationKind normalization = jbo::NormalizationKind::No,
+            const jbo::DirectionKind direction = jbo::DirectionKind::Forward,
+            bool* fallback = nullptr)
+        {
+            const Variant variant = isSupported(stage) ? tune(stage)
+                                                       : Variant{jbo::RadixKind::Radix_2, jbo::DecimationKind::In_Time};
+
+            return getEntry(variant).create(stage, window, normalization, direction, fallback);
+        }
+
+        /** Returns a plan of the fastest variant from the process wide PlanCache.
+            \param[in] stage ... The stage of the FFT plan which is to be returned, i.e. 2^stage samples.
+            \param[in] window ... The window applied before the FFT.
+            \param[in] normalization ... The normalization applied after the FFT.
+            \param[in] direction ... The direction of the FFT.
+            \param[out] fallback ... Optional. Set to true, if a RuntimeAlgorithm is returned, otherwise false.
+            \return ExecutableAlgorithm ... Reference to the immutable FFT plan.
+        */
+        const ExecutableAlgorithm<Complex>& getAlgorithmInstance(const std::size_t stage,
+            const jbo::WindowKind window = jbo::WindowKind::None,
+            const jbo::NormalizationKind normalization = jbo::NormalizationKind::No,
+            const jbo::DirectionKind direction = jbo::DirectionKind::Forward,
+            bool* fallback = nullptr)
+        {
+            const Variant variant = isSupported(stage) ? tune(stage)
+                                                       : Variant{jbo::RadixKind::Radix_2, jbo::DecimationKind::In_Time};
+
+            return getEntry(variant).getInstance(stage, window, normalization, direction, fallback);
+        }
+    };
+}
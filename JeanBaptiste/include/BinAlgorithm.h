@@ -0,0 +1,72 @@
+#pragma once
+
+#include <boost/hana.hpp>
+#include "core/Goertzel.h"
+#include "ExecutableAlgorithm.h"
+#include "normalization/NormalizationSelection.h"
+#include "Options.h"
+#include "windowing/WindowSelection.h"
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** Defines a tuple of executable sub tasks which calculate selected bins of a DFT using Goertzel: window, Goertzel, normalization.
+        Bin k is written to data[k], the same position a FFT algorithm would put it. All other elements are undefined.
+        \param SampleCnt ... The count of samples.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+        \param Bins ... The indices of the bins to be calculated: 0 ... SampleCnt - 1.
+    */
+    template <typename SampleCnt,
+              typename Direction,
+              typename Window,
+              typename Normalization,
+              typename Complex,
+              typename WindowInput,
+              int... Bins>
+    class BinAlgorithm
+        : public ExecutableAlgorithm<Complex>
+    {
+        /** Creates a value of the selected direction type at compilation time.
+            \return value ... The selected value.
+        */
+        static constexpr auto getDirectionValue(void)
+        {
+            return hana::if_(
+                hana::typeid_(Direction{}) == hana::type<jbo::Direction_Forward>{},
+                    std::integral_constant<int, 1>{},
+                    std::integral_constant<int, -1>{});
+        }
+
+        using SubTaskTypes = hana::tuple<
+            decltype(windowing::selectWindow<Window, SampleCnt, Complex, WindowInput>()),
+            core::Goertzel<SampleCnt, typename decltype(getDirectionValue())::type, Complex, Bins...>,
+            decltype(normalization::selectNormalization<Normalization, SampleCnt, Complex>())>;
+
+        SubTaskTypes tupleOfSubTasks_;
+
+    public:
+        /** Executes all sub tasks sequentially.
+            \param[in] data ... Pointer to an array of SampleCnt elements of type Complex.
+        */
+        void operator()(Complex* data) const override
+        {
+            hana::for_each(tupleOfSubTasks_, [&](const auto& subTask)
+            {
+                subTask(data);
+            });
+        }
+
+        std::size_t numberOfSamples(void) const override
+        {
+            return SampleCnt::value;
+        }
+
+        std::size_t numberOfFrequencies(void) const override
+        {
+            return SampleCnt::value >> 1;
+        }
+    };
+}
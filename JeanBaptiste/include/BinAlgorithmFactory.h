@@ -0,0 +1,102 @@
+#pragma once
+
+#include "AlgorithmFactory.h"
+#include "BinAlgorithm.h"
+#include <array>
+#include <boost/hana.hpp>
+#include <cassert>
+#include <memory>
+#include "Options.h"
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** A factory for algorithms calculating a few selected bins of a DFT.
+        Goertzel costs O(N) per bin whereas a FFT costs O(N log2(N)) for all bins. Per stage the factory therefore returns a
+        Goertzel based BinAlgorithm if fewer bins than log2(N) are requested and a FFT algorithm otherwise.
+        Either way bin k is found at data[k] after execution.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Complex ... The complex data type.
+        \param Bins ... The indices of the requested bins.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Direction,
+              typename Window,
+              typename Normalization,
+              typename Complex,
+              int... Bins>
+    class BinAlgorithmFactory
+    {
+        using Creator = std::unique_ptr<ExecutableAlgorithm<Complex>> (*)(void);
+
+        /** Calculates log2 of the sample count of an algorithm of the given stage.
+        */
+        static constexpr std::size_t getLog2SampleCnt(const std::size_t stage)
+        {
+            if constexpr (hana::typeid_(Radix{}) == hana::type<jbo::Radix_4>{})
+                return stage << 1;
+            else
+                return stage;
+        }
+
+        /** Creates the algorithm of the given stage.
+            \param Stage ... The stage of the algorithm.
+        */
+        template <int Stage>
+        static std::unique_ptr<ExecutableAlgorithm<Complex>> createAlgorithm(void)
+        {
+            if constexpr (prefersGoertzel(Stage))
+            {
+                using SampleCnt = typename decltype(std::integral_constant<int, 1 << getLog2SampleCnt(Stage)>{})::type;
+                return std::make_unique<BinAlgorithm<SampleCnt, Direction, Window, Normalization, Complex,
+                    jbo::WindowInput_Real, Bins...>>();
+            }
+            else
+                return std::make_unique<Algorithm<std::integral_constant<int, Stage>, Radix, Decimation, Direction,
+                    Window, Normalization, Complex>>();
+        }
+
+        /** Creates a table of algorithm creation functions indexed by stage - Begin at compilation time.
+            \return std::array ... The creation function of each stage.
+        */
+        static constexpr auto createCreatorTable(void)
+        {
+            return hana::unpack(hana::make_range(hana::int_c<Begin>, hana::int_c<End>), [](auto... stage)
+            {
+                return std::array<Creator, sizeof...(stage)>
+                {
+                    &createAlgorithm<decltype(stage)::value>...
+                };
+            });
+        }
+
+        static constexpr auto creatorTable_ = createCreatorTable();
+
+    public:
+        /** Returns whether an algorithm of the given stage calculates the requested bins using Goertzel.
+            \param[in] stage ... The stage of the FFT algorithm.
+        */
+        static constexpr bool prefersGoertzel(const std::size_t stage)
+        {
+            return sizeof...(Bins) < getLog2SampleCnt(stage)
+                && ((static_cast<std::size_t>(Bins) < (std::size_t{1} << getLog2SampleCnt(stage))) && ...);
+        }
+
+        /** Creates a pointer to an algorithm instantiation.
+            \param[in] stage ... The stage of the algorithm which is to be returned.
+            \return std::unique_ptr ... Pointer to the algorithm instantiation.
+        */
+        std::unique_ptr<ExecutableAlgorithm<Complex>> getAlgorithm(const std::size_t stage) const
+        {
+            assert(stage >= Begin && stage < End && "Trying to find algorithm of unknown stage.");
+
+            return creatorTable_[stage - Begin]();
+        }
+    };
+}
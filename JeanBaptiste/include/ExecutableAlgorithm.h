@@ -1,5 +1,9 @@
 #pragma once
 
+#include <complex>
+#include <optional>
+#include "postprocessing/Peak.h"
+
 namespace jeanbaptiste
 {
     /** Defines a unique interface for dynamic algorithms.
@@ -15,6 +19,23 @@ namespace jeanbaptiste
         virtual void operator()(Complex* data) const
         {}
 
+        /** Runs the algorithm and puts out its real spectrum, if it has one.
+            \return bool ... False, if the algorithm does not support a real spectrum. Data and spectrum are untouched then.
+        */
+        virtual bool calculateSpectrum(Complex*, typename Complex::value_type*) const
+        {
+            return false;
+        }
+
+        /** Runs the algorithm and finds the strongest peaks of its spectrum, if it supports peak detection.
+            \return std::optional ... The count of peaks found. Empty, if the algorithm does not support peak detection.
+            Data and peaks are untouched then.
+        */
+        virtual std::optional<std::size_t> findPeaks(Complex*, postprocessing::Peak<typename Complex::value_type>*) const
+        {
+            return std::nullopt;
+        }
+
         virtual std::size_t numberOfSamples(void) const
         {
             return 0;
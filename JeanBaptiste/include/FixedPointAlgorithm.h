@@ -0,0 +1,120 @@
+#pragma once
+
+#include "basic/BitReversalIndexSwapping.h"
+#include "basic/FixedPoint.h"
+#include <boost/hana.hpp>
+#include "core/FixedPointRadix2.h"
+#include "core/FixedPointRadix4.h"
+#include "Options.h"
+#include <type_traits>
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** Defines a unique interface for dynamic fixed point algorithms.
+        \param Complex ... Fixed point complex data type: basic::ComplexQ15 or basic::ComplexQ31.
+    */
+    template <typename Complex = basic::ComplexQ15>
+    class ExecutableFixedPointAlgorithm
+    {
+    public:
+        virtual ~ExecutableFixedPointAlgorithm()
+        {}
+
+        /** Runs the FFT in place.
+            \param[in, out] data ... Pointer to an array of numberOfSamples() elements of type Complex in Q format.
+            \return int ... The block exponent e: the DFT equals the result multiplied by 2^e.
+        */
+        virtual int operator()(Complex* data) const = 0;
+
+        virtual std::size_t numberOfSamples(void) const = 0;
+
+        virtual std::size_t numberOfFrequencies(void) const = 0;
+    };
+
+    /** Runs a FFT on complex numbers in Q format with block floating point scaling: bit reversal and a fixed point core.
+        Samples are processed in their storage format without conversion. There is no window and no normalization:
+        the result is the DFT scaled by 2^-blockExponent.
+        \param Stage ... The count of stages inside an FFT algorithm. E.g. Stages = 4 -> sample count = 2^4 (Radix_2), 4^4 (Radix_4)
+        \param Radix ... The radix of the algorithm: Radix_2 or Radix_4.
+        \param Complex ... Fixed point complex data type: basic::ComplexQ15 or basic::ComplexQ31.
+    */
+    template <typename Stage,
+              typename Radix,
+              typename Decimation,
+              typename Direction,
+              typename Complex>
+    class FixedPointAlgorithm
+        : public ExecutableFixedPointAlgorithm<Complex>
+    {
+        static_assert(!std::is_same_v<Radix, jbo::Radix_Split_2_4>, "Trying to create a fixed point split radix algorithm.");
+
+        using SampleCnt = std::integral_constant<int, std::is_same_v<Radix, jbo::Radix_4> ? 1 << (Stage::value << 1) : 1 << Stage::value>;
+
+        /** Creates a value of the selected direction type at compilation time.
+            \return value ... The selected value.
+        */
+        static constexpr auto getDirectionValue(void)
+        {
+            return hana::if_(
+                hana::typeid_(Direction{}) == hana::type<jbo::Direction_Forward>{},
+                    std::integral_constant<int, 1>{},
+                    std::integral_constant<int, -1>{});
+        }
+
+        /** Creates a value of the selected fixed point core at compilation time.
+            \return value ... The selected value.
+        */
+        static constexpr auto getCoreValue(void)
+        {
+            using DirectionFactor = typename decltype(getDirectionValue())::type;
+            using CoreSampleCnt = std::integral_constant<unsigned, SampleCnt::value>;
+
+            if constexpr (std::is_same_v<Radix, jbo::Radix_4>)
+                return hana::if_(
+                    hana::typeid_(Decimation{}) == hana::type<jbo::Decimation_In_Time>{},
+                        core::FixedPointRadix4DIT<CoreSampleCnt, DirectionFactor, Complex>{},
+                        core::FixedPointRadix4DIF<CoreSampleCnt, DirectionFactor, Complex>{});
+            else
+                return hana::if_(
+                    hana::typeid_(Decimation{}) == hana::type<jbo::Decimation_In_Time>{},
+                        core::FixedPointRadix2DIT<CoreSampleCnt, DirectionFactor, Complex>{},
+                        core::FixedPointRadix2DIF<CoreSampleCnt, DirectionFactor, Complex>{});
+        }
+
+        basic::BitReversalIndexSwapping<SampleCnt, Complex> bitReversal_;
+        decltype(getCoreValue()) core_;
+
+    public:
+        /** Runs bit reversal and the fixed point core in the order of the decimation type.
+            \param[in, out] data ... Pointer to an array of SampleCnt elements of type Complex in Q format.
+            \return int ... The block exponent e: the DFT equals the result multiplied by 2^e.
+        */
+        int operator()(Complex* data) const override
+        {
+            if constexpr (std::is_same_v<Decimation, jbo::Decimation_In_Time>)
+            {
+                bitReversal_(data);
+                return core_.apply(data);
+            }
+            else
+            {
+                auto blockExponent = core_.apply(data);
+                bitReversal_(data);
+                return blockExponent;
+            }
+        }
+
+        std::size_t numberOfSamples(void) const override
+        {
+            return SampleCnt::value;
+        }
+
+        std::size_t numberOfFrequencies(void) const override
+        {
+            return SampleCnt::value >> 1;
+        }
+    };
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <boost/hana.hpp>
+#include <cassert>
+#include "FixedPointAlgorithm.h"
+#include <memory>
+
+namespace hana = boost::hana;
+
+namespace jeanbaptiste
+{
+    /** A factory for fixed point FFT algorithms of different stage. Each stage is used for a certain count of data samples.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Radix ... The radix of the algorithms: Radix_2 or Radix_4.
+        \param Complex ... Fixed point complex data type: basic::ComplexQ15 or basic::ComplexQ31.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Direction,
+              typename Complex>
+    class FixedPointAlgorithmFactory
+    {
+        using Creator = std::unique_ptr<ExecutableFixedPointAlgorithm<Complex>> (*)(void);
+
+        template <typename AlgorithmType>
+        static std::unique_ptr<ExecutableFixedPointAlgorithm<Complex>> createAlgorithm(void)
+        {
+            return std::make_unique<AlgorithmType>();
+        }
+
+        /** Creates a table of algorithm creation functions indexed by stage - Begin at compilation time.
+            \return std::array ... The creation function of each stage.
+        */
+        static constexpr auto createCreatorTable(void)
+        {
+            return hana::unpack(hana::make_range(hana::int_c<Begin>, hana::int_c<End>), [](auto... stage)
+            {
+                return std::array<Creator, sizeof...(stage)>
+                {
+                    &createAlgorithm<FixedPointAlgorithm<std::integral_constant<int, decltype(stage)::value>, Radix,
+                        Decimation, Direction, Complex>>...
+                };
+            });
+        }
+
+        static constexpr auto creatorTable_ = createCreatorTable();
+
+    public:
+        /** Creates a pointer to a fixed point FFT algorithm instantiation.
+            \param[in] stage ... The stage of the FFT algorithm which is to be returned.
+            \return std::unique_ptr ... Pointer to the FFT algorithm instantiation.
+        */
+        std::unique_ptr<ExecutableFixedPointAlgorithm<Complex>> getAlgorithm(const std::size_t stage) const
+        {
+            assert(stage >= Begin && stage < End && "Trying to find algorithm of unknown stage.");
+
+            return creatorTable_[stage - Begin]();
+        }
+    };
+}
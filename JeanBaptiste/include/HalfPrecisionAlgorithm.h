@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Algorithm.h"
+#include "basic/HalfPrecision.h"
+#include <complex>
+#include "Options.h"
+#include "tools/HalfPrecisionConversion.h"
+#include <vector>
+
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** Defines a unique interface for dynamic algorithms on 16 bit storage.
+        \param Half ... The storage type: basic::Float16 or basic::BFloat16.
+    */
+    template <typename Half = basic::Float16>
+    class ExecutableHalfPrecisionAlgorithm
+    {
+    public:
+        virtual ~ExecutableHalfPrecisionAlgorithm()
+        {}
+
+        virtual void operator()(basic::HalfComplex<Half>* data) = 0;
+
+        virtual std::size_t numberOfSamples(void) const = 0;
+
+        virtual std::size_t numberOfFrequencies(void) const = 0;
+    };
+
+    /** Runs a FFT algorithm on complex numbers stored in 16 bit: the buffer is converted into a float working buffer once,
+        all sub tasks run in float and the result is converted back once. The 16 bit storage halves the memory of data at
+        rest, e.g. of large batches of frames, while all intermediate results keep float precision. It does not reduce the
+        memory traffic of a transform: the conversions add a load and a store sweep over both buffers, so a transform moves
+        more bytes than a float algorithm running in place. The working buffer is owned by this instance. Not thread safe.
+        \param Stage ... The count of stages inside an FFT algorithm. E.g. Stages = 4 -> sample count = 2^4
+        \param Half ... The storage type: basic::Float16 or basic::BFloat16.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <typename Stage,
+              typename Radix,
+              typename Decimation,
+              typename Direction,
+              typename Window,
+              typename Normalization,
+              typename Half,
+              typename WindowInput = jbo::WindowInput_Real>
+    class HalfPrecisionAlgorithm
+        : public ExecutableHalfPrecisionAlgorithm<Half>
+    {
+        Algorithm<Stage, Radix, Decimation, Direction, Window, Normalization, std::complex<float>, WindowInput> algorithm_;
+        std::vector<std::complex<float>> buffer_;
+
+    public:
+        HalfPrecisionAlgorithm(void)
+            : buffer_(algorithm_.numberOfSamples())
+        {}
+
+        /** Converts, transforms and converts back in place.
+            \param[in, out] data ... Pointer to an array of numberOfSamples() 16 bit complex numbers.
+        */
+        void operator()(basic::HalfComplex<Half>* data) override
+        {
+            tools::HalfPrecisionConversion<Half>::load(data, &buffer_[0], buffer_.size());
+            algorithm_(&buffer_[0]);
+            tools::HalfPrecisionConversion<Half>::store(&buffer_[0], data, buffer_.size());
+        }
+
+        std::size_t numberOfSamples(void) const override
+        {
+            return algorithm_.numberOfSamples();
+        }
+
+        std::size_t numberOfFrequencies(void) const override
+        {
+            return algorithm_.numberOfFrequencies();
+        }
+    };
+}
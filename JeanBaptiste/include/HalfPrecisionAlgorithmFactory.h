@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <boost/hana.hpp>
+#include <cassert>
+#include "HalfPrecisionAlgorithm.h"
+#include <memory>
+#include "Options.h"
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** A factory for FFT algorithms on 16 bit storage of different stage. Each stage is used for a certain count of data samples.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Half ... The storage type: basic::Float16 or basic::BFloat16.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Direction,
+              typename Window,
+              typename Normalization,
+              typename Half,
+              typename WindowInput = jbo::WindowInput_Real>
+    class HalfPrecisionAlgorithmFactory
+    {
+        using Creator = std::unique_ptr<ExecutableHalfPrecisionAlgorithm<Half>> (*)(void);
+
+        template <typename AlgorithmType>
+        static std::unique_ptr<ExecutableHalfPrecisionAlgorithm<Half>> createAlgorithm(void)
+        {
+            return std::make_unique<AlgorithmType>();
+        }
+
+        /** Creates a table of algorithm creation functions indexed by stage - Begin at compilation time.
+            \return std::array ... The creation function of each stage.
+        */
+        static constexpr auto createCreatorTable(void)
+        {
+            return hana::unpack(hana::make_range(hana::int_c<Begin>, hana::int_c<End>), [](auto... stage)
+            {
+                return std::array<Creator, sizeof...(stage)>
+                {
+                    &createAlgorithm<HalfPrecisionAlgorithm<std::integral_constant<int, decltype(stage)::value>, Radix,
+                        Decimation, Direction, Window, Normalization, Half, WindowInput>>...
+                };
+            });
+        }
+
+        static constexpr auto creatorTable_ = createCreatorTable();
+
+    public:
+        /** Creates a pointer to an FFT algorithm instantiation.
+            \param[in] stage ... The stage of the FFT algorithm which is to be returned.
+            \return std::unique_ptr ... Pointer to the FFT algorithm instantiation.
+        */
+        std::unique_ptr<ExecutableHalfPrecisionAlgorithm<Half>> getAlgorithm(const std::size_t stage) const
+        {
+            assert(stage >= Begin && stage < End && "Trying to find algorithm of unknown stage.");
+
+            return creatorTable_[stage - Begin]();
+        }
+    };
+}
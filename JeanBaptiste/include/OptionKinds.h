@@ -0,0 +1,50 @@
+#pragma once
+
+#include <boost/hana.hpp>
+#include "Options.h"
+#include <type_traits>
+
+namespace hana = boost::hana;
+
+namespace jeanbaptiste::options
+{
+    // The options selected by the values of WindowKind and NormalizationKind, in the order of the enums.
+    constexpr auto kWindowOptions = hana::tuple_t<Window_None, Window_Bartlett, Window_BlackmanHarris, Window_Blackman,
+        Window_Cosine, Window_FlatTop, Window_Hamming, Window_vonHann, Window_Welch>;
+    constexpr auto kNormalizationOptions = hana::tuple_t<Normalization_No, Normalization_Division_By_Length,
+        Normalization_Square_Root>;
+
+    // The options selected by the values of RadixKind and DecimationKind, in the order of the enums.
+    constexpr auto kRadixOptions = hana::tuple_t<Radix_2, Radix_4, Radix_Split_2_4>;
+    constexpr auto kDecimationOptions = hana::tuple_t<Decimation_In_Time, Decimation_In_Frequency>;
+
+    /** Converts a window option into the WindowKind selecting it at runtime.
+        \param Window ... The window option, e.g. Window_Hamming.
+    */
+    template <typename Window>
+    constexpr WindowKind toWindowKind(void)
+    {
+        return static_cast<WindowKind>(std::decay_t<decltype(hana::index_if(kWindowOptions,
+            hana::equal.to(hana::type_c<Window>)).value())>::value);
+    }
+
+    /** Converts a normalization option into the NormalizationKind selecting it at runtime.
+        \param Normalization ... The normalization option, e.g. Normalization_Square_Root.
+    */
+    template <typename Normalization>
+    constexpr NormalizationKind toNormalizationKind(void)
+    {
+        return static_cast<NormalizationKind>(std::decay_t<decltype(hana::index_if(kNormalizationOptions,
+            hana::equal.to(hana::type_c<Normalization>)).value())>::value);
+    }
+
+    /** Converts a direction option into the DirectionKind selecting it at runtime.
+        Direction_Backward_Conjugated results in the same transform as Direction_Backward.
+        \param Direction ... The direction option, e.g. Direction_Forward.
+    */
+    template <typename Direction>
+    constexpr DirectionKind toDirectionKind(void)
+    {
+        return std::is_same_v<Direction, Direction_Forward> ? DirectionKind::Forward : DirectionKind::Backward;
+    }
+}
@@ -1,17 +1,34 @@
 #pragma once
 
+#include <cstddef>
+
 namespace jeanbaptiste::options
 {
+    struct Dct_II {};
+    struct Dct_III {};
+    struct Dct_IV {};
     struct Direction_Forward {};
     struct Direction_Backward {};
+    struct Direction_Backward_Conjugated {};
     struct Decimation_In_Frequency {};
     struct Decimation_In_Time {};
+    struct Interpolation_Jacobsen {};
+    struct Interpolation_Parabolic {};
     struct Normalization_No {};
     struct Normalization_Division_By_Length {};
     struct Normalization_Square_Root {};
+    template <typename Normalization> struct Normalization_Conjugated {};
+    struct Precision_Data {};
+    struct Precision_Mixed {};
     struct Radix_2 {};
     struct Radix_4 {};
     struct Radix_Split_2_4 {};
+    struct Spectrum_Complex {};
+    struct Spectrum_Decibel {};
+    struct Spectrum_Magnitude {};
+    struct Spectrum_Phase {};
+    template <std::size_t PeakCnt, typename Interpolation = Interpolation_Parabolic> struct Spectrum_Peaks {};
+    struct Spectrum_Power {};
     struct Window_None {};
     struct Window_Bartlett {};
     struct Window_BlackmanHarris {};
@@ -21,4 +38,16 @@ namespace jeanbaptiste::options
     struct Window_Hamming {};
     struct Window_vonHann {};
     struct Window_Welch {};
+    struct WindowInput_Real {};
+    struct WindowInput_Complex {};
+    template <typename WindowInput> struct WindowInput_Conjugated {};
+
+    // Options selected at runtime by a Plan. Their order equals the one of the option tuples of OptionKinds.h.
+    enum class DirectionKind { Forward, Backward };
+    enum class NormalizationKind { No, Division_By_Length, Square_Root };
+    enum class WindowKind { None, Bartlett, BlackmanHarris, Blackman, Cosine, FlatTop, Hamming, vonHann, Welch };
+
+    // Variants of the core selected at runtime by an Autotuner, in the order of the option tuples of OptionKinds.h.
+    enum class RadixKind { Radix_2, Radix_4, Radix_Split_2_4 };
+    enum class DecimationKind { In_Time, In_Frequency };
 }
\ No newline at end of file
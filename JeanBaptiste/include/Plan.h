@@ -0,0 +1,156 @@
+#pragma once
+
+#include <array>
+#include "basic/BitReversalIndexSwapping.h"
+#include <boost/hana.hpp>
+#include <cassert>
+#include <complex>
+#include "core/Radix2.h"
+#include "core/Radix4.h"
+#include "core/RadixSplit24.h"
+#include "ExecutableAlgorithm.h"
+#include "normalization/NormalizationSelection.h"
+#include "OptionKinds.h"
+#include "Options.h"
+#include <type_traits>
+#include "windowing/WindowSelection.h"
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** An FFT algorithm whose window, normalization and direction are selected at runtime.
+        The core (radix, decimation, stage) is chosen at compilation time as for Algorithm. The window and normalization
+        kernels of a stage and the forward and backward cores are instantiated once and shared by all plans of that stage,
+        instead of one Algorithm per combination of window, normalization and direction.
+        A plan runs its kernels through function pointers selected on construction.
+        \param Stage ... The count of stages inside an FFT algorithm. E.g. Stages = 4 -> sample count = 2^4
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <typename Stage,
+              typename Radix,
+              typename Decimation,
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
+    class Plan final
+        : public ExecutableAlgorithm<Complex>
+    {
+        using SampleCnt = typename decltype(std::conditional_t<std::is_same_v<Radix, jbo::Radix_4>,
+            std::integral_constant<int, 1 << (Stage::value << 1)>,
+            std::integral_constant<int, 1 << Stage::value>>{})::type;
+
+        using Kernel = void (*)(Complex*);
+
+        /** Selects the core of radix and decimation for a direction.
+            \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        */
+        template <typename DirectionFactor>
+        using Core =
+            std::conditional_t<std::is_same_v<Radix, jbo::Radix_2>,
+                std::conditional_t<std::is_same_v<Decimation, jbo::Decimation_In_Time>,
+                    core::Radix2DIT<SampleCnt, DirectionFactor, Complex>,
+                    core::Radix2DIF<SampleCnt, DirectionFactor, Complex>>,
+            std::conditional_t<std::is_same_v<Radix, jbo::Radix_4>,
+                std::conditional_t<std::is_same_v<Decimation, jbo::Decimation_In_Time>,
+                    core::Radix4DIT<SampleCnt, DirectionFactor, Complex>,
+                    core::Radix4DIF<SampleCnt, DirectionFactor, Complex>>,
+                std::conditional_t<std::is_same_v<Decimation, jbo::Decimation_In_Time>,
+                    core::RadixSplit24DIT<SampleCnt, DirectionFactor, Complex>,
+                    core::RadixSplit24DIF<SampleCnt, DirectionFactor, Complex>>>>;
+
+        template <typename SubTaskType>
+        static void runSubTask(Complex* data)
+        {
+            SubTaskType{}(data);
+        }
+
+        // The direction factors in the order of jbo::DirectionKind.
+        static constexpr auto directionFactors_ = hana::tuple_t<std::integral_constant<int, 1>,
+            std::integral_constant<int, -1>>;
+
+        static constexpr auto createWindowKernels(void)
+        {
+            return hana::unpack(jbo::kWindowOptions, [](auto... windowOption)
+            {
+                return std::array<Kernel, sizeof...(windowOption)>
+                {
+                    &runSubTask<decltype(windowing::selectWindow<typename decltype(windowOption)::type, SampleCnt, Complex,
+                        WindowInput>())>...
+                };
+            });
+        }
+
+        static constexpr auto createNormalizationKernels(void)
+        {
+            return hana::unpack(jbo::kNormalizationOptions, [](auto... normalizationOption)
+            {
+                return std::array<Kernel, sizeof...(normalizationOption)>
+                {
+                    &runSubTask<decltype(normalization::selectNormalization<typename decltype(normalizationOption)::type,
+                        SampleCnt, Complex>())>...
+                };
+            });
+        }
+
+        static constexpr auto createCoreKernels(void)
+        {
+            return hana::unpack(directionFactors_, [](auto... directionFactor)
+            {
+                return std::array<Kernel, sizeof...(directionFactor)>
+                {
+                    &runSubTask<Core<typename decltype(directionFactor)::type>>...
+                };
+            });
+        }
+
+        static constexpr auto windowKernels_ = createWindowKernels();
+        static constexpr auto normalizationKernels_ = createNormalizationKernels();
+        static constexpr auto coreKernels_ = createCoreKernels();
+        static constexpr Kernel bitReversalKernel_ = &runSubTask<basic::BitReversalIndexSwapping<SampleCnt, Complex>>;
+
+        // Window, bit reversal and core (DIT) or core and bit reversal (DIF), normalization.
+        std::array<Kernel, 4> kernels_;
+
+    public:
+        /** Selects the kernels of the plan.
+            \param[in] window ... The window applied before the FFT.
+            \param[in] normalization ... The normalization applied after the FFT.
+            \param[in] direction ... The direction of the FFT.
+        */
+        Plan(const jbo::WindowKind window, const jbo::NormalizationKind normalization, const jbo::DirectionKind direction)
+        {
+            assert(static_cast<std::size_t>(window) < windowKernels_.size() && "Trying to select an unknown window.");
+            assert(static_cast<std::size_t>(normalization) < normalizationKernels_.size()
+                && "Trying to select an unknown normalization.");
+            assert(static_cast<std::size_t>(direction) < coreKernels_.size() && "Trying to select an unknown direction.");
+
+            auto coreKernel = coreKernels_[static_cast<std::size_t>(direction)];
+
+            kernels_[0] = windowKernels_[static_cast<std::size_t>(window)];
+            kernels_[1] = std::is_same_v<Decimation, jbo::Decimation_In_Time> ? bitReversalKernel_ : coreKernel;
+            kernels_[2] = std::is_same_v<Decimation, jbo::Decimation_In_Time> ? coreKernel : bitReversalKernel_;
+            kernels_[3] = normalizationKernels_[static_cast<std::size_t>(normalization)];
+        }
+
+        /** Executes all kernels sequentially.
+            \param[in] data ... Pointer to an array of SampleCnt elements of type Complex.
+        */
+        void operator()(Complex* data) const override
+        {
+            for (auto kernel : kernels_)
+                kernel(data);
+        }
+
+        std::size_t numberOfSamples(void) const override
+        {
+            return SampleCnt::value;
+        }
+
+        std::size_t numberOfFrequencies(void) const override
+        {
+            return SampleCnt::value >> 1;
+        }
+    };
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include "ExecutableAlgorithm.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include "Options.h"
+#include <shared_mutex>
+#include <tuple>
+
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** A process wide cache of immutable FFT plans. Radix, decimation, complex type and window input select the cache at
+        compilation time, the stage, window, normalization and direction of a plan and whether it is a runtime fallback are its key at runtime.
+        A plan is created on its first request and lives until the end of the program, so that later requests of the same
+        key neither allocate nor rebuild tables. Lookups share a lock, creation is exclusive, so the cache is thread safe.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <typename Radix,
+              typename Decimation,
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
+    class PlanCache
+    {
+        // Plans of a stage which is compiled into one factory may be runtime plans of another one.
+        using Key = std::tuple<std::size_t, jbo::WindowKind, jbo::NormalizationKind, jbo::DirectionKind, bool>;
+
+        static inline std::shared_mutex mutex_;
+        static inline std::map<Key, std::unique_ptr<const ExecutableAlgorithm<Complex>>> plans_;
+
+    public:
+        /** Returns the cached plan of a key. If there is none, it is created by create and stored.
+            \param[in] stage ... The stage of the FFT plan.
+            \param[in] window ... The window applied before the FFT.
+            \param[in] normalization ... The normalization applied after the FFT.
+            \param[in] direction ... The direction of the FFT.
+            \param[in] fallback ... Whether the plan is a RuntimeAlgorithm instead of a compiled plan.
+            \param[in] create ... Returns a std::unique_ptr to a new plan of the key. Called at most once per key, unless it throws.
+            \return ExecutableAlgorithm ... Reference to the immutable plan.
+        */
+        template <typename Create>
+        static const ExecutableAlgorithm<Complex>& getPlan(const std::size_t stage, const jbo::WindowKind window,
+            const jbo::NormalizationKind normalization, const jbo::DirectionKind direction, const bool fallback, Create&& create)
+        {
+            const Key key(stage, window, normalization, direction, fallback);
+
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+                auto plan = plans_.find(key);
+
+                if (plan != plans_.end())
+                    return *plan->second;
+            }
+
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            auto plan = plans_.find(key);
+
+            // Another thread may have created the plan in between. The plan is stored once it is created, so that no entry
+            // is left behind if create throws.
+            if (plan == plans_.end())
+                plan = plans_.emplace(key, create()).first;
+
+            return *plan->second;
+        }
+
+        /** Returns the count of cached plans.
+        */
+        static std::size_t size(void)
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+
+            return plans_.size();
+        }
+    };
+}
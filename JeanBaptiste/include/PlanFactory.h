@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <boost/hana.hpp>
+#include <cassert>
+#include <complex>
+#include "ExecutableAlgorithm.h"
+#include <memory>
+#include "Options.h"
+#include "Plan.h"
+#include "PlanCache.h"
+#include "RuntimeAlgorithm.h"
+#include <type_traits>
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** A factory for FFT plans of different stage. The window, the normalization and the direction of a plan are selected at
+        runtime, so that one factory replaces all AlgorithmFactory instantiations which differ in these options only.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
+    class PlanFactory
+    {
+        using Creator = std::unique_ptr<ExecutableAlgorithm<Complex>> (*)(jbo::WindowKind, jbo::NormalizationKind,
+            jbo::DirectionKind);
+
+        template <typename PlanType>
+        static std::unique_ptr<ExecutableAlgorithm<Complex>> createPlan(const jbo::WindowKind window,
+            const jbo::NormalizationKind normalization, const jbo::DirectionKind direction)
+        {
+            return std::make_unique<PlanType>(window, normalization, direction);
+        }
+
+        /** Creates a table of plan creation functions indexed by stage - Begin at compilation time.
+            \return std::array ... The creation function of each stage.
+        */
+        static constexpr auto createCreatorTable(void)
+        {
+            return hana::unpack(hana::make_range(hana::int_c<Begin>, hana::int_c<End>), [](auto... stage)
+            {
+                return std::array<Creator, sizeof...(stage)>
+                {
+                    &createPlan<Plan<decltype(stage), Radix, Decimation, Complex, WindowInput>>...
+                };
+            });
+        }
+
+        static constexpr auto creatorTable_ = createCreatorTable();
+
+        /** Checks whether the stage is within [Begin, End).
+        */
+        static bool isSupported(const std::size_t stage)
+        {
+            return stage >= Begin && stage < End;
+        }
+
+    public:
+        /** Creates an FFT plan. For a stage outside of [Begin, End) a RuntimeAlgorithm of the same options is created instead.
+            The RuntimeAlgorithm ignores Decimation and always runs decimation in time passes, which yields the same result.
+            \param[in] stage ... The stage of the FFT plan which is to be returned.
+            \param[in] window ... The window applied before the FFT.
+            \param[in] normalization ... The normalization applied after the FFT.
+            \param[in] direction ... The direction of the FFT.
+            \param[out] fallback ... Optional. Set to true, if a RuntimeAlgorithm is returned, otherwise false.
+            \return std::unique_ptr ... Pointer to the FFT plan.
+            \exception std::length_error ... The sample count of a fallback stage exceeds the largest supported length.
+        */
+        std::unique_ptr<ExecutableAlgorithm<Complex>> getAlgorithm(const std::size_t stage,
+            const jbo::WindowKind window = jbo::WindowKind::None,
+            const jbo::NormalizationKind normalization = jbo::NormalizationKind::No,
+            const jbo::DirectionKind direction = jbo::DirectionKind::Forward,
+            bool* fallback = nullptr) const
+        {
+            const bool supported = isSupported(stage);
+
+            if (fallback)
+                *fallback = !supported;
+
+            if (!supported)
+            {
+                const auto sampleCnt = RuntimeAlgorithm<Complex, WindowInput>::template getSampleCount<Radix>(stage);
+
+                return std::make_unique<RuntimeAlgorithm<Complex, WindowInput>>(sampleCnt, window, normalization, direction);
+            }
+
+            return creatorTable_[stage - Begin](window, normalization, direction);
+        }
+
+        /** Returns a plan from the process wide PlanCache without allocation, except for the first request of its options.
+            The plan is shared by all plan factories of the same radix, decimation, complex type and window input and lives
+            until the end of the program. Safe to be called from multiple threads.
+            \param[in] stage ... The stage of the FFT plan which is to be returned.
+            \param[in] window ... The window applied before the FFT.
+            \param[in] normalization ... The normalization applied after the FFT.
+            \param[in] direction ... The direction of the FFT.
+            \param[out] fallback ... Optional. Set to true, if a RuntimeAlgorithm is returned, otherwise false.
+            \return ExecutableAlgorithm ... Reference to the immutable FFT plan.
+            \exception std::length_error ... The sample count of a fallback stage exceeds the largest supported length.
+        */
+        const ExecutableAlgorithm<Complex>& getAlgorithmInstance(const std::size_t stage,
+            const jbo::WindowKind window = jbo::WindowKind::None,
+            const jbo::NormalizationKind normalization = jbo::NormalizationKind::No,
+            const jbo::DirectionKind direction = jbo::DirectionKind::Forward,
+            bool* fallback = nullptr) const
+        {
+            const bool supported = isSupported(stage);
+
+            if (fallback)
+                *fallback = !supported;
+
+            return PlanCache<Radix, Decimation, Complex, WindowInput>::getPlan(stage, window, normalization, direction,
+                !supported, [&]()
+            {
+                return getAlgorithm(stage, window, normalization, direction);
+            });
+        }
+    };
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "basic/BitReversalIndexSwapping.h"
+#include <boost/hana.hpp>
+#include "core/PrunedRadix2.h"
+#include "ExecutableAlgorithm.h"
+#include "normalization/NormalizationSelection.h"
+#include "Options.h"
+#include "windowing/WindowSelection.h"
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** Defines a tuple of executable sub tasks which belong to a pruned radix 2 FFT task.
+        Only the first InputCnt samples may be non zero (e.g. zero padded frames) and only the first OutputCnt frequencies are
+        calculated (e.g. narrowband outputs). All other frequencies are undefined.
+        \param Stage ... The count of stages inside an FFT algorithm. E.g. Stages = 4 -> sample count = 2^4
+        \param Complex ... The complex data type.
+        \param InputCnt ... The count of leading samples which may be non zero.
+        \param OutputCnt ... The count of leading frequencies which are needed.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <typename Stage,
+              typename Decimation,
+              typename Direction,
+              typename Window,
+              typename Normalization,
+              typename Complex,
+              typename InputCnt,
+              typename OutputCnt,
+              typename WindowInput = jbo::WindowInput_Real>
+    class PrunedAlgorithm
+        : public ExecutableAlgorithm<Complex>
+    {
+        using SampleCnt = typename decltype(std::integral_constant<int, 1 << Stage::value>{})::type;
+
+        /** Creates a value of the selected direction type at compilation time.
+            \return value ... The selected value.
+        */
+        static constexpr auto getDirectionValue(void)
+        {
+            return hana::if_(
+                hana::typeid_(Direction{}) == hana::type<jbo::Direction_Forward>{},
+                    std::integral_constant<int, 1>{},
+                    std::integral_constant<int, -1>{});
+        }
+
+        /** Creates a tupel of sub task type values at compilation time.
+            \return hana::tuple_t ... A tuple of sub task type values.
+        */
+        static constexpr auto createTupleOfSubTaskTypeValues(void)
+        {
+            return hana::if_(
+                hana::typeid_(Decimation{}) == hana::type<jbo::Decimation_In_Time>{},
+                    hana::tuple_t<
+                        decltype(windowing::selectWindow<Window, SampleCnt, Complex, WindowInput>()),
+                        basic::BitReversalIndexSwapping<SampleCnt, Complex>,
+                        core::PrunedRadix2DIT<SampleCnt, typename decltype(getDirectionValue())::type, Complex, InputCnt, OutputCnt>,
+                        decltype(normalization::selectNormalization<Normalization, SampleCnt, Complex>())>,
+                    hana::tuple_t<
+                        decltype(windowing::selectWindow<Window, SampleCnt, Complex, WindowInput>()),
+                        core::PrunedRadix2DIF<SampleCnt, typename decltype(getDirectionValue())::type, Complex, InputCnt, OutputCnt>,
+                        basic::BitReversalIndexSwapping<SampleCnt, Complex>,
+                        decltype(normalization::selectNormalization<Normalization, SampleCnt, Complex>())>);
+        }
+
+        using SubTaskTypes = typename decltype(hana::unpack(createTupleOfSubTaskTypeValues(), hana::template_<hana::tuple>))::type;
+
+        SubTaskTypes tupleOfSubTasks_;
+
+    public:
+        /** Executes all sub tasks sequentially.
+            \param[in] data ... Pointer to an array of SampleCnt elements of type Complex.
+        */
+        void operator()(Complex* data) const override
+        {
+            hana::for_each(tupleOfSubTasks_, [&](const auto& subTask)
+            {
+                subTask(data);
+            });
+        }
+
+        std::size_t numberOfSamples(void) const override
+        {
+            return SampleCnt::value;
+        }
+
+        std::size_t numberOfFrequencies(void) const override
+        {
+            return SampleCnt::value >> 1;
+        }
+    };
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <boost/hana.hpp>
+#include <cassert>
+#include <memory>
+#include "Options.h"
+#include "PrunedAlgorithm.h"
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** A factory for pruned radix 2 FFT algorithms of different stage. Each stage is used for a certain count of data samples.
+        The pruning is given relative to the sample count N of each stage:
+        only the first N / InputDivisor samples may be non zero and only the first N / OutputDivisor frequencies are calculated.
+        E.g. InputDivisor = 8 suits a frame which is zero padded to 8 times its length.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Complex ... The complex data type.
+        \param InputDivisor ... The ratio of sample count to the count of leading samples which may be non zero (1: no pruning).
+        \param OutputDivisor ... The ratio of sample count to the count of leading frequencies which are needed (1: no pruning).
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Decimation,
+              typename Direction,
+              typename Window,
+              typename Normalization,
+              typename Complex,
+              std::size_t InputDivisor,
+              std::size_t OutputDivisor,
+              typename WindowInput = jbo::WindowInput_Real>
+    class PrunedAlgorithmFactory
+    {
+        static_assert(InputDivisor > 0 && OutputDivisor > 0, "Trying to prune by a divisor of zero.");
+
+        using Creator = std::unique_ptr<ExecutableAlgorithm<Complex>> (*)(void);
+
+        /** Creates the pruned FFT algorithm of the given stage.
+            \param Stage ... The stage of the algorithm.
+        */
+        template <int Stage>
+        static std::unique_ptr<ExecutableAlgorithm<Complex>> createAlgorithm(void)
+        {
+            constexpr unsigned kSampleCnt = 1u << Stage;
+
+            return std::make_unique<PrunedAlgorithm<std::integral_constant<int, Stage>, Decimation, Direction, Window,
+                Normalization, Complex, std::integral_constant<unsigned, (kSampleCnt + InputDivisor - 1) / InputDivisor>,
+                std::integral_constant<unsigned, (kSampleCnt + OutputDivisor - 1) / OutputDivisor>, WindowInput>>();
+        }
+
+        /** Creates a table of algorithm creation functions indexed by stage - Begin at compilation time.
+            \return std::array ... The creation function of each stage.
+        */
+        static constexpr auto createCreatorTable(void)
+        {
+            return hana::unpack(hana::make_range(hana::int_c<Begin>, hana::int_c<End>), [](auto... stage)
+            {
+                return std::array<Creator, sizeof...(stage)>
+                {
+                    &createAlgorithm<decltype(stage)::value>...
+                };
+            });
+        }
+
+        static constexpr auto creatorTable_ = createCreatorTable();
+
+    public:
+        /** Creates a pointer to a pruned FFT algorithm instantiation.
+            \param[in] stage ... The stage of the FFT algorithm which is to be returned.
+            \return std::unique_ptr ... Pointer to the FFT algorithm instantiation.
+        */
+        std::unique_ptr<ExecutableAlgorithm<Complex>> getAlgorithm(const std::size_t stage) const
+        {
+            assert(stage >= Begin && stage < End && "Trying to find algorithm of unknown stage.");
+
+            return creatorTable_[stage - Begin]();
+        }
+    };
+}
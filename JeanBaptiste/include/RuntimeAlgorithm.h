@@ -0,0 +1,245 @@
+#pragma once
+
+#include <array>
+#include <boost/hana.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include "ExecutableAlgorithm.h"
+#include <limits>
+#include "OptionKinds.h"
+#include "Options.h"
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "windowing/ExecuteWindowOnComplexData.h"
+#include "windowing/WindowSelection.h"
+
+namespace constants = boost::math::constants;
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste
+{
+    /** An FFT algorithm of a sample count known at runtime only. The factories fall back to it for stages outside of their
+        compiled range, which trades the speed of the compiled algorithms for not having to instantiate every sample count
+        that might occur.
+        Instead of recursive sub tasks it runs iterative radix 4 passes (two radix 2 passes fused into one butterfly of four
+        values) and a final radix 2 pass for an odd count of stages. The twiddle factors, the bit reversal swaps and the window
+        samples are calculated once on construction. The decimation does not change the result, so the passes are always DIT.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
+    class RuntimeAlgorithm final
+        : public ExecutableAlgorithm<Complex>
+    {
+        using ValueType = typename Complex::value_type;
+        using SampleCreator = ValueType (*)(std::size_t, std::size_t);
+
+        /** Creates a table of the window sample calculations indexed by jbo::WindowKind at compilation time.
+            The formulas do not depend on the sample count the window types are instantiated with.
+            \return std::array ... The sample calculation of each window.
+        */
+        static constexpr auto createSampleCreatorTable(void)
+        {
+            return hana::unpack(jbo::kWindowOptions, [](auto... windowOption)
+            {
+                return std::array<SampleCreator, sizeof...(windowOption)>
+                {
+                    &decltype(windowing::selectWindow<typename decltype(windowOption)::type, std::integral_constant<int, 2>,
+                        Complex>())::createSample...
+                };
+            });
+        }
+
+        static constexpr auto sampleCreatorTable_ = createSampleCreatorTable();
+
+        /** Calculates the bit reversed counterpart of an index of bitCnt significant bits.
+        */
+        static std::size_t getReverseIndex(std::size_t index, const std::size_t bitCnt)
+        {
+            std::size_t reverseIndex = 0;
+
+            for (std::size_t i = 0; i < bitCnt; ++i, index >>= 1)
+                reverseIndex = (reverseIndex << 1) | (index & 1);
+
+            return reverseIndex;
+        }
+
+        /** Combines the blocks of 2 * half samples of two radix 2 passes into blocks of 4 * half samples, e.g. 4 blocks of 1
+            sample into 1 block of 4 samples.
+            \param[in, out] data ... Pointer to an array of sampleCnt_ elements of type Complex.
+            \param[in] half ... Half the block length of the first of both radix 2 passes.
+        */
+        void runRadix4Pass(Complex* data, const std::size_t half) const
+        {
+            const std::size_t firstStride = sampleCnt_ / (half << 1);
+            const std::size_t secondStride = firstStride >> 1;
+
+            for (std::size_t block = 0; block < sampleCnt_; block += half << 2)
+            {
+                for (std::size_t i = 0; i < half; ++i)
+                {
+                    const Complex firstTwiddle = twiddles_[i * firstStride];
+                    const Complex secondTwiddle = twiddles_[i * secondStride];
+                    const Complex thirdTwiddle = twiddles_[(i + half) * secondStride];
+
+                    Complex* value0 = data + block + i;
+                    Complex* value1 = value0 + half;
+                    Complex* value2 = value1 + half;
+                    Complex* value3 = value2 + half;
+
+                    const Complex product1 = firstTwiddle * *value1;
+                    const Complex product3 = firstTwiddle * *value3;
+                    const Complex sum01 = *value0 + product1;
+                    const Complex difference01 = *value0 - product1;
+                    const Complex product23 = secondTwiddle * (*value2 + product3);
+                    const Complex productDifference23 = thirdTwiddle * (*value2 - product3);
+
+                    *value0 = sum01 + product23;
+                    *value1 = difference01 + productDifference23;
+                    *value2 = sum01 - product23;
+                    *value3 = difference01 - productDifference23;
+                }
+            }
+        }
+
+        /** Combines blocks of half samples into blocks of 2 * half samples.
+            \param[in, out] data ... Pointer to an array of sampleCnt_ elements of type Complex.
+            \param[in] half ... Half the block length of the pass.
+        */
+        void runRadix2Pass(Complex* data, const std::size_t half) const
+        {
+            const std::size_t stride = sampleCnt_ / (half << 1);
+
+            for (std::size_t block = 0; block < sampleCnt_; block += half << 1)
+            {
+                for (std::size_t i = 0; i < half; ++i)
+                {
+                    const Complex product = twiddles_[i * stride] * data[block + i + half];
+                    data[block + i + half] = data[block + i] - product;
+                    data[block + i] += product;
+                }
+            }
+        }
+
+        std::size_t sampleCnt_;
+        std::vector<Complex> twiddles_;
+        std::vector<std::pair<std::size_t, std::size_t>> swaps_;
+        std::vector<ValueType> window_;
+        ValueType normalizationFactor_;
+        bool normalize_;
+
+    public:
+        /** Calculates the tables of the algorithm.
+            \param[in] sampleCnt ... The count of samples, a power of 2.
+            \param[in] window ... The window applied before the FFT.
+            \param[in] normalization ... The normalization applied after the FFT.
+            \param[in] direction ... The direction of the FFT.
+        */
+        RuntimeAlgorithm(const std::size_t sampleCnt, const jbo::WindowKind window, const jbo::NormalizationKind normalization,
+            const jbo::DirectionKind direction)
+            : sampleCnt_(sampleCnt)
+            , twiddles_(sampleCnt >> 1)
+            , normalizationFactor_(1)
+            , normalize_(normalization != jbo::NormalizationKind::No)
+        {
+            assert(sampleCnt > 1 && (sampleCnt & (sampleCnt - 1)) == 0 && "Trying to create an algorithm of a sample count "
+                "which is not a power of 2.");
+            assert(static_cast<std::size_t>(window) < sampleCreatorTable_.size() && "Trying to select an unknown window.");
+
+            // Twiddle factors w^k = e^(j * 2 * pi * k / N) of the forward direction as used by the cores, in double precision.
+            const double directionFactor = direction == jbo::DirectionKind::Forward ? 1.0 : -1.0;
+
+            for (std::size_t k = 0; k < twiddles_.size(); ++k)
+            {
+                const double angle = directionFactor * 2.0 * constants::pi<double>() * k / sampleCnt;
+                twiddles_[k] = Complex(static_cast<ValueType>(std::cos(angle)), static_cast<ValueType>(std::sin(angle)));
+            }
+
+            std::size_t bitCnt = 0;
+            while ((std::size_t{1} << bitCnt) < sampleCnt)
+                ++bitCnt;
+
+            for (std::size_t i = 0; i < sampleCnt; ++i)
+            {
+                const std::size_t reverseIndex = getReverseIndex(i, bitCnt);
+
+                if (i < reverseIndex)
+                    swaps_.emplace_back(i, reverseIndex);
+            }
+
+            if (window != jbo::WindowKind::None)
+            {
+                window_.resize(sampleCnt);
+
+                for (std::size_t i = 0; i < sampleCnt; ++i)
+                    window_[i] = sampleCreatorTable_[static_cast<std::size_t>(window)](i, sampleCnt);
+            }
+
+            if (normalization == jbo::NormalizationKind::Division_By_Length)
+                normalizationFactor_ = static_cast<ValueType>(1.0 / sampleCnt);
+            else if (normalization == jbo::NormalizationKind::Square_Root)
+                normalizationFactor_ = static_cast<ValueType>(1.0 / std::sqrt(static_cast<double>(sampleCnt)));
+        }
+
+        /** Calculates the sample count of a stage for the fallback of the factories. The stage is checked before shifting,
+            so that stages of more samples than std::size_t can count or the tables can hold are rejected.
+            \param Radix ... The radix the stage counts in. Radix_4 stages count 4^stage samples, all others 2^stage samples.
+            \param[in] stage ... The stage of the FFT algorithm.
+            \return std::size_t ... The count of samples of the stage.
+            \exception std::length_error ... The sample count exceeds the largest supported length.
+        */
+        template <typename Radix>
+        static std::size_t getSampleCount(const std::size_t stage)
+        {
+            const std::size_t stageBits = std::is_same_v<Radix, jbo::Radix_4> ? 2 : 1;
+
+            if (stage >= std::numeric_limits<std::size_t>::digits / stageBits ||
+                (std::size_t{1} << (stage * stageBits)) > std::vector<std::pair<std::size_t, std::size_t>>().max_size())
+                throw std::length_error("Trying to create a runtime algorithm exceeding the largest supported length.");
+
+            return std::size_t{1} << (stage * stageBits);
+        }
+
+        /** Applies the window, the bit reversal, all passes and the normalization sequentially.
+            \param[in] data ... Pointer to an array of numberOfSamples() elements of type Complex.
+        */
+        void operator()(Complex* data) const override
+        {
+            if (!window_.empty())
+                windowing::ExecuteWindowOnComplexData<Complex, WindowInput>{}(data, window_.data(), sampleCnt_);
+
+            for (const auto& swap : swaps_)
+                std::swap(data[swap.first], data[swap.second]);
+
+            std::size_t half = 1;
+
+            for (; (half << 2) <= sampleCnt_; half <<= 2)
+                runRadix4Pass(data, half);
+
+            if (half < sampleCnt_)
+                runRadix2Pass(data, half);
+
+            if (normalize_)
+            {
+                for (std::size_t i = 0; i < sampleCnt_; ++i)
+                    data[i] *= normalizationFactor_;
+            }
+        }
+
+        std::size_t numberOfSamples(void) const override
+        {
+            return sampleCnt_;
+        }
+
+        std::size_t numberOfFrequencies(void) const override
+        {
+            return sampleCnt_ >> 1;
+        }
+    };
+}
@@ -16,11 +16,13 @@ namespace jeanbaptiste::basic
         \param SampleCnt ... The count of samples used for the bit reversal.
                              This masks the significant sequence of bits in a 16 bit number.
         \param Complex ... The complex data type.
+        \param Conjugate ... std::true_type conjugates all elements while swapping them, see Direction_Backward_Conjugated.
     */
     template<typename SampleCnt,
-             typename Complex>
+             typename Complex,
+             typename Conjugate = std::false_type>
     class BitReversalIndexSwapping
-        : public SubTask<BitReversalIndexSwapping<SampleCnt, Complex>,
+        : public SubTask<BitReversalIndexSwapping<SampleCnt, Complex, Conjugate>,
                          Complex>
     {
         /** The reversal is based on 16 bits always. There is a significant sequence of bits within these 16 bits. For example having a 
@@ -60,7 +62,7 @@ namespace jeanbaptiste::basic
             std::size_t value2 = ((value1 & 0xCCCC) >> 2) | ((value1 & 0x3333) << 2);
             std::size_t value3 = ((value2 & 0xF0F0) >> 4) | ((value2 & 0x0F0F) << 4);
 
-            return               ((value3 & 0xFF00) >> 8) | ((value3 & 0x00FF) << 8)
+            return              (((value3 & 0xFF00) >> 8) | ((value3 & 0x00FF) << 8))
                               >> significantBitShiftLookupTable_[hana::int_c<SampleCnt::value>];
         }
 
@@ -96,9 +98,21 @@ namespace jeanbaptiste::basic
         */
         void operator()(Complex* data) const
         {
-            for (auto i = 0; i < SampleCnt::value; ++i)
+            for (std::size_t i = 0; i < SampleCnt::value; ++i)
             {
-                if (i < swapLookupTable_[i])
+                if constexpr (Conjugate::value)
+                {
+                    // Each pair is visited once, elements which are their own counterpart are conjugated in place.
+                    if (i < swapLookupTable_[i])
+                    {
+                        const Complex value = std::conj(data[i]);
+                        data[i] = std::conj(data[swapLookupTable_[i]]);
+                        data[swapLookupTable_[i]] = value;
+                    }
+                    else if (i == swapLookupTable_[i])
+                        data[i] = std::conj(data[i]);
+                }
+                else if (i < swapLookupTable_[i])
                     std::swap(data[i], data[swapLookupTable_[i]]);
             }
         }
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <boost/math/constants/constants.hpp>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace constants = boost::math::constants;
+
+namespace jeanbaptiste::basic
+{
+    namespace internal
+    {
+        /** Describes the bit layout of IEEE 754 floating point numbers.
+        */
+        template <typename T>
+        struct FloatingPointLayout;
+
+        template <>
+        struct FloatingPointLayout<float>
+        {
+            using Bits = std::uint32_t;
+            static constexpr int kMantissaBits_ = 23;
+            static constexpr Bits kExponentMask_ = 0xff;
+            static constexpr int kExponentBias_ = 127;
+        };
+
+        template <>
+        struct FloatingPointLayout<double>
+        {
+            using Bits = std::uint64_t;
+            static constexpr int kMantissaBits_ = 52;
+            static constexpr Bits kExponentMask_ = 0x7ff;
+            static constexpr int kExponentBias_ = 1023;
+        };
+    }
+
+    /** Approximates log2(x) for positive normal x without branches so that loops calling it can be vectorized.
+        x = m * 2^e is split by its bit pattern into m in [sqrt(1/2), sqrt(2)) and e.
+        log2(m) = 2 / ln(2) * atanh(t) with t = (m - 1) / (m + 1), |t| < 0.172, is evaluated by the first five terms of its
+        power series. The relative error is below 1e-9 which is more than enough for float.
+        \param[in] x ... A positive normal value.
+        \return T ... The approximation of log2(x).
+    */
+    template <typename T>
+    inline T fastLog2(const T x)
+    {
+        static_assert(std::is_floating_point<T>::value, "Trying to generate a logarithm using a non floating point type.");
+
+        using Layout = internal::FloatingPointLayout<T>;
+        using Bits = typename Layout::Bits;
+
+        Bits bits;
+        std::memcpy(&bits, &x, sizeof(T));
+
+        auto exponent = static_cast<int>((bits >> Layout::kMantissaBits_) & Layout::kExponentMask_) - Layout::kExponentBias_;
+
+        // Replace the exponent by the bias to get the mantissa in [1, 2).
+        bits = (bits & ((Bits{1} << Layout::kMantissaBits_) - 1)) | (static_cast<Bits>(Layout::kExponentBias_) << Layout::kMantissaBits_);
+        T mantissa;
+        std::memcpy(&mantissa, &bits, sizeof(T));
+
+        // Move the mantissa into [sqrt(1/2), sqrt(2)) to keep t small.
+        const bool isLarge = mantissa > constants::root_two<T>();
+        mantissa = isLarge ? mantissa * T(0.5) : mantissa;
+        exponent += isLarge;
+
+        const T t = (mantissa - 1) / (mantissa + 1);
+        const T t2 = t * t;
+        const T series = t * (T(1) + t2 * (T(1) / 3 + t2 * (T(1) / 5 + t2 * (T(1) / 7 + t2 * (T(1) / 9)))));
+
+        return static_cast<T>(exponent) + series * (2 / constants::ln_two<T>());
+    }
+
+    /** Approximates 10 * log10(x) for positive x. Values below the smallest normal value are clamped to it.
+        \param[in] x ... A positive value, e.g. a power.
+        \return T ... The approximation of 10 * log10(x) in dB.
+    */
+    template <typename T>
+    inline T fastDecibel(const T x)
+    {
+        const T clamped = (x < std::numeric_limits<T>::min()) ? std::numeric_limits<T>::min() : x;
+
+        // 10 * log10(x) = 10 * log10(2) * log2(x)
+        return T(10) * constants::ln_two<T>() / constants::ln_ten<T>() * fastLog2(clamped);
+    }
+}
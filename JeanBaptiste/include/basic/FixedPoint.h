@@ -0,0 +1,224 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include "SineCosine.h"
+#include <boost/math/constants/constants.hpp>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace constants = boost::math::constants;
+
+namespace jeanbaptiste::basic
+{
+    /** Describes the Q format of a fixed point number: Q15 for std::int16_t, Q31 for std::int32_t.
+        A value v represents v / 2^FractionBits in [-1, 1).
+        \param Integer ... The integer type holding the fixed point number.
+    */
+    template <typename Integer>
+    struct FixedPointFormat;
+
+    template <>
+    struct FixedPointFormat<std::int16_t>
+    {
+        // Type which holds products and sums of two numbers without overflow.
+        using WideType = std::int32_t;
+        static constexpr int kFractionBits = 15;
+    };
+
+    template <>
+    struct FixedPointFormat<std::int32_t>
+    {
+        // Type which holds products and sums of two numbers without overflow.
+        using WideType = std::int64_t;
+        static constexpr int kFractionBits = 31;
+    };
+
+    /** A complex number of two fixed point numbers in Q format. It provides the interface of std::complex used by the
+        fixed point FFT algorithms and the bit reversal. Sums are not saturated: the algorithms prevent overflows by block
+        floating point scaling.
+        \param Integer ... The integer type holding real and imaginary part: std::int16_t (Q15) or std::int32_t (Q31).
+    */
+    template <typename Integer>
+    class FixedPointComplex
+    {
+        Integer real_;
+        Integer imag_;
+
+    public:
+        using value_type = Integer;
+
+        constexpr FixedPointComplex(const Integer real = 0, const Integer imag = 0)
+            : real_(real),
+              imag_(imag)
+        {}
+
+        constexpr Integer real(void) const
+        {
+            return real_;
+        }
+
+        constexpr Integer imag(void) const
+        {
+            return imag_;
+        }
+
+        constexpr void real(const Integer value)
+        {
+            real_ = value;
+        }
+
+        constexpr void imag(const Integer value)
+        {
+            imag_ = value;
+        }
+
+        constexpr FixedPointComplex& operator+=(const FixedPointComplex& other)
+        {
+            real_ = static_cast<Integer>(real_ + other.real_);
+            imag_ = static_cast<Integer>(imag_ + other.imag_);
+            return *this;
+        }
+
+        constexpr FixedPointComplex& operator-=(const FixedPointComplex& other)
+        {
+            real_ = static_cast<Integer>(real_ - other.real_);
+            imag_ = static_cast<Integer>(imag_ - other.imag_);
+            return *this;
+        }
+
+        friend constexpr FixedPointComplex operator+(FixedPointComplex left, const FixedPointComplex& right)
+        {
+            return left += right;
+        }
+
+        friend constexpr FixedPointComplex operator-(FixedPointComplex left, const FixedPointComplex& right)
+        {
+            return left -= right;
+        }
+
+        friend constexpr bool operator==(const FixedPointComplex& left, const FixedPointComplex& right)
+        {
+            return left.real_ == right.real_ && left.imag_ == right.imag_;
+        }
+
+        friend constexpr bool operator!=(const FixedPointComplex& left, const FixedPointComplex& right)
+        {
+            return !(left == right);
+        }
+    };
+
+    using ComplexQ15 = FixedPointComplex<std::int16_t>;
+    using ComplexQ31 = FixedPointComplex<std::int32_t>;
+
+    /** Converts a floating point value in [-1, 1) into Q format. The value is rounded and saturated.
+    */
+    template <typename Integer>
+    constexpr Integer toFixedPoint(const double value)
+    {
+        constexpr double kScale = static_cast<double>(std::int64_t{1} << FixedPointFormat<Integer>::kFractionBits);
+        auto scaled = std::clamp(value * kScale, -kScale, kScale - 1.0);
+
+        // Rounds half away from zero. The 64 bit conversion holds Q31 as well.
+        return static_cast<Integer>(static_cast<std::int64_t>(scaled + ((scaled < 0) ? -0.5 : 0.5)));
+    }
+
+    /** Converts a number in Q format into a floating point value in [-1, 1).
+    */
+    template <typename T = double, typename Integer>
+    constexpr T toFloatingPoint(const Integer value)
+    {
+        return static_cast<T>(value) / static_cast<T>(std::int64_t{1} << FixedPointFormat<Integer>::kFractionBits);
+    }
+
+    /** Multiplies two complex numbers in Q format. The products are accumulated in the wide type and rounded once.
+    */
+    template <typename Integer>
+    constexpr FixedPointComplex<Integer> multiply(const FixedPointComplex<Integer>& left, const FixedPointComplex<Integer>& right)
+    {
+        using WideType = typename FixedPointFormat<Integer>::WideType;
+        constexpr int kFractionBits = FixedPointFormat<Integer>::kFractionBits;
+        constexpr WideType kHalf = WideType{1} << (kFractionBits - 1);
+
+        WideType real = WideType{left.real()} * right.real() - WideType{left.imag()} * right.imag();
+        WideType imag = WideType{left.real()} * right.imag() + WideType{left.imag()} * right.real();
+
+        return FixedPointComplex<Integer>(
+            static_cast<Integer>((real + kHalf) >> kFractionBits),
+            static_cast<Integer>((imag + kHalf) >> kFractionBits));
+    }
+
+    /** Multiplies a complex number by j * DirectionFactor, which is a rotation by +/-90 degrees without rounding.
+    */
+    template <typename DirectionFactor, typename Integer>
+    constexpr FixedPointComplex<Integer> rotate(const FixedPointComplex<Integer>& value)
+    {
+        if constexpr (DirectionFactor::value > 0)
+            return FixedPointComplex<Integer>(static_cast<Integer>(-value.imag()), value.real());
+        else
+            return FixedPointComplex<Integer>(value.imag(), static_cast<Integer>(-value.real()));
+    }
+
+    /** Divides a complex number in Q format by 2^shift with rounding. Used for block floating point scaling.
+    */
+    template <typename Integer>
+    constexpr FixedPointComplex<Integer> shiftRight(const FixedPointComplex<Integer>& value, const int shift)
+    {
+        using WideType = typename FixedPointFormat<Integer>::WideType;
+
+        if (shift == 0)
+            return value;
+
+        const WideType half = WideType{1} << (shift - 1);
+        return FixedPointComplex<Integer>(
+            static_cast<Integer>((WideType{value.real()} + half) >> shift),
+            static_cast<Integer>((WideType{value.imag()} + half) >> shift));
+    }
+
+    /** Returns the maximum of the absolute values of real and imaginary part in the wide type, to be accumulated over a block.
+    */
+    template <typename Integer>
+    constexpr auto maximumAbs(const FixedPointComplex<Integer>& value)
+    {
+        using WideType = typename FixedPointFormat<Integer>::WideType;
+
+        WideType real = value.real();
+        WideType imag = value.imag();
+        return std::max(real < 0 ? -real : real, imag < 0 ? -imag : imag);
+    }
+
+    /** Calculates the shift that brings the maximum of a block below limit.
+        \param[in] maximum ... The maximum of the absolute values of real and imaginary parts within the block.
+        \param[in] limit ... The maximum which may be processed by the next stage without overflow.
+        \return int ... The count of bits the block has to be shifted right.
+    */
+    template <typename WideType>
+    constexpr int calculateBlockShift(WideType maximum, const WideType limit)
+    {
+        int shift = 0;
+        for (; maximum >= limit; maximum >>= 1)
+            ++shift;
+
+        return shift;
+    }
+
+    /** Creates a table of TwiddleCnt twiddle factors W^k = e^(j * DirectionFactor * 2 * pi * k / SampleCnt) in Q format
+        at compilation time. A real part of 1 is saturated to the largest representable value.
+    */
+    template <typename SampleCnt,
+              typename DirectionFactor,
+              typename Complex,
+              std::size_t... Indices>
+    constexpr auto createFixedPointTwiddles(std::index_sequence<Indices...>)
+    {
+        using Integer = typename Complex::value_type;
+
+        return std::array<Complex, sizeof...(Indices)>
+        {
+            Complex(
+                toFixedPoint<Integer>(cosine<double>(2.0 * constants::pi<double>() * Indices / SampleCnt::value)),
+                toFixedPoint<Integer>(DirectionFactor::value * sine<double>(2.0 * constants::pi<double>() * Indices / SampleCnt::value)))...
+        };
+    }
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace jeanbaptiste::basic
+{
+    /** IEEE 754 binary16 number: 1 sign bit, 5 exponent bits, 10 mantissa bits. Used for storage only.
+    */
+    struct Float16
+    {
+        std::uint16_t bits;
+    };
+
+    /** bfloat16 number: the upper half of an IEEE 754 binary32 number. It has the range of float but 7 mantissa bits only.
+        Used for storage only.
+    */
+    struct BFloat16
+    {
+        std::uint16_t bits;
+    };
+
+    namespace internal
+    {
+        inline std::uint32_t floatToBits(const float value)
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        inline float bitsToFloat(const std::uint32_t bits)
+        {
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    }
+
+    /** Converts a float into binary16 rounding to nearest even. Overflows become infinity, NaN stays NaN.
+    */
+    inline Float16 toFloat16(const float value)
+    {
+        constexpr std::uint32_t kFloatInfinity = 255u << 23;
+        // The smallest float which overflows binary16 after rounding.
+        constexpr std::uint32_t kHalfOverflow = (127u + 16u) << 23;
+        // The smallest float which is a normal binary16 number: 2^-14.
+        constexpr std::uint32_t kHalfNormal = (127u - 14u) << 23;
+        // Adding 0.5 aligns the mantissa of binary16 subnormals to the low bits of the float mantissa.
+        constexpr std::uint32_t kSubnormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        auto bits = internal::floatToBits(value);
+        auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+        bits &= 0x7FFFFFFFu;
+
+        std::uint16_t result;
+        if (bits >= kHalfOverflow)
+            result = (bits > kFloatInfinity) ? 0x7E00u : 0x7C00u;
+        else if (bits < kHalfNormal)
+            result = static_cast<std::uint16_t>(
+                internal::floatToBits(internal::bitsToFloat(bits) + internal::bitsToFloat(kSubnormalMagic)) - kSubnormalMagic);
+        else
+        {
+            auto mantissaOdd = (bits >> 13) & 1u;
+            // Rebias the exponent and round: adding 0xFFF plus the lowest kept bit rounds to nearest even.
+            bits += ((15u - 127u) << 23) + 0xFFFu + mantissaOdd;
+            result = static_cast<std::uint16_t>(bits >> 13);
+        }
+
+        return Float16{static_cast<std::uint16_t>(result | sign)};
+    }
+
+    /** Converts a binary16 number into float exactly.
+    */
+    inline float toFloat(const Float16 value)
+    {
+        constexpr std::uint32_t kShiftedExponent = 0x7C00u << 13;
+        // 2^-14 as float to normalize binary16 subnormals.
+        constexpr std::uint32_t kSubnormalMagic = 113u << 23;
+
+        std::uint32_t bits = static_cast<std::uint32_t>(value.bits & 0x7FFFu) << 13;
+        auto exponent = bits & kShiftedExponent;
+        bits += (127u - 15u) << 23;
+
+        if (exponent == kShiftedExponent)
+            // Infinity or NaN.
+            bits += (128u - 16u) << 23;
+        else if (exponent == 0)
+            // Zero or subnormal.
+            bits = internal::floatToBits(internal::bitsToFloat(bits + (1u << 23)) - internal::bitsToFloat(kSubnormalMagic));
+
+        return internal::bitsToFloat(bits | (static_cast<std::uint32_t>(value.bits & 0x8000u) << 16));
+    }
+
+    /** Converts a float into bfloat16 rounding to nearest even. NaN stays NaN.
+    */
+    inline BFloat16 toBFloat16(const float value)
+    {
+        auto bits = internal::floatToBits(value);
+
+        if ((bits & 0x7FFFFFFFu) > 0x7F800000u)
+            return BFloat16{static_cast<std::uint16_t>((bits >> 16) | 0x0040u)};
+
+        return BFloat16{static_cast<std::uint16_t>((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16)};
+    }
+
+    /** Converts a bfloat16 number into float exactly.
+    */
+    inline float toFloat(const BFloat16 value)
+    {
+        return internal::bitsToFloat(static_cast<std::uint32_t>(value.bits) << 16);
+    }
+
+    /** A complex number of two 16 bit floating point numbers for storage. Arithmetic is done in float after conversion.
+        \param Half ... The storage type of real and imaginary part: Float16 or BFloat16.
+    */
+    template <typename Half>
+    class HalfComplex
+    {
+        Half real_;
+        Half imag_;
+
+        static Half fromFloat(const float value)
+        {
+            if constexpr (std::is_same_v<Half, Float16>)
+                return toFloat16(value);
+            else
+                return toBFloat16(value);
+        }
+
+    public:
+        using value_type = Half;
+
+        HalfComplex(void)
+            : real_{0},
+              imag_{0}
+        {}
+
+        HalfComplex(const std::complex<float>& value)
+            : real_(fromFloat(value.real())),
+              imag_(fromFloat(value.imag()))
+        {}
+
+        float real(void) const
+        {
+            return toFloat(real_);
+        }
+
+        float imag(void) const
+        {
+            return toFloat(imag_);
+        }
+
+        operator std::complex<float>(void) const
+        {
+            return std::complex<float>(real(), imag());
+        }
+    };
+
+    using ComplexFloat16 = HalfComplex<Float16>;
+    using ComplexBFloat16 = HalfComplex<BFloat16>;
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include "../basic/FixedPoint.h"
+#include <type_traits>
+#include <utility>
+#include "../SubTask.h"
+
+namespace jeanbaptiste::core
+{
+    /** Performs a radix 2 decimation in time FFT on complex numbers in Q format (basic::ComplexQ15, basic::ComplexQ31).
+        The stages are processed iteratively, so that block floating point scaling is applied per stage: the maximum of each
+        stage's output is tracked and the next stage shifts its inputs right as long as the maximum may overflow.
+        The result is the DFT scaled by 2^-blockExponent. The twiddle factors are created at compilation time.
+        \param SampleCnt ... The count of samples.
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The fixed point complex type.
+    */
+    template<typename SampleCnt,
+             typename DirectionFactor,
+             typename Complex>
+    class FixedPointRadix2DIT
+        : public SubTask<FixedPointRadix2DIT<SampleCnt, DirectionFactor, Complex>,
+                         Complex>
+    {
+        using Integer = typename Complex::value_type;
+        using WideType = typename basic::FixedPointFormat<Integer>::WideType;
+
+        // A butterfly's output grows by 1 + sqrt(2) in the worst case, which stays below full scale for inputs below 1/3.
+        static constexpr WideType kHeadroomLimit_ = (WideType{1} << basic::FixedPointFormat<Integer>::kFractionBits) / 3;
+        static constexpr auto kTwiddles_ = basic::createFixedPointTwiddles<SampleCnt, DirectionFactor, Complex>(
+            std::make_index_sequence<SampleCnt::value / 2>{});
+
+    public:
+        void operator()(Complex* data) const
+        {
+            apply(data);
+        }
+
+        /** Runs the FFT in place on bit reversed data.
+            \param[in, out] data ... Pointer to an array of SampleCnt elements of type Complex.
+            \return int ... The block exponent: the count of bits the data has been shifted right.
+        */
+        int apply(Complex* data) const
+        {
+            WideType maximum = 0;
+            for (std::size_t i = 0; i < SampleCnt::value; ++i)
+                maximum = std::max(maximum, basic::maximumAbs(data[i]));
+
+            int blockExponent = 0;
+
+            // dualNodeDistance is the distance between elements (successive nodes) of a dual tuple: 1, 2, 4, ...
+            for (std::size_t dualNodeDistance = 1; dualNodeDistance < SampleCnt::value; dualNodeDistance <<= 1)
+            {
+                auto shift = basic::calculateBlockShift(maximum, kHeadroomLimit_);
+                auto twiddleStride = SampleCnt::value / (dualNodeDistance << 1);
+                blockExponent += shift;
+                maximum = 0;
+
+                for (std::size_t groupNodeIdx = 0; groupNodeIdx < SampleCnt::value; groupNodeIdx += dualNodeDistance << 1)
+                {
+                    for (std::size_t r = 0; r < dualNodeDistance; ++r)
+                    {
+                        auto idxNode0 = groupNodeIdx + r;
+                        auto idxNode1 = idxNode0 + dualNodeDistance;
+                        // DIT radix-2 butterfly:
+                        // X[r]          = G[r] + H[r] * W^r
+                        // X[r + N/2]    = G[r] - H[r] * W^r
+                        auto node0 = basic::shiftRight(data[idxNode0], shift);
+                        auto product = basic::multiply(kTwiddles_[r * twiddleStride], basic::shiftRight(data[idxNode1], shift));
+
+                        data[idxNode0] = node0 + product;
+                        data[idxNode1] = node0 - product;
+
+                        maximum = std::max({maximum, basic::maximumAbs(data[idxNode0]), basic::maximumAbs(data[idxNode1])});
+                    }
+                }
+            }
+
+            return blockExponent;
+        }
+    };
+
+    /** Performs a radix 2 decimation in frequency FFT on complex numbers in Q format (basic::ComplexQ15, basic::ComplexQ31).
+        The stages are processed iteratively, so that block floating point scaling is applied per stage: the maximum of each
+        stage's output is tracked and the next stage shifts its inputs right as long as the maximum may overflow.
+        The result is the bit reversed DFT scaled by 2^-blockExponent. The twiddle factors are created at compilation time.
+        \param SampleCnt ... The count of samples.
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The fixed point complex type.
+    */
+    template<typename SampleCnt,
+             typename DirectionFactor,
+             typename Complex>
+    class FixedPointRadix2DIF
+        : public SubTask<FixedPointRadix2DIF<SampleCnt, DirectionFactor, Complex>,
+                         Complex>
+    {
+        using Integer = typename Complex::value_type;
+        using WideType = typename basic::FixedPointFormat<Integer>::WideType;
+
+        // The difference of a butterfly grows by 2 * sqrt(2) in the worst case, which stays below full scale for inputs below 1/3.
+        static constexpr WideType kHeadroomLimit_ = (WideType{1} << basic::FixedPointFormat<Integer>::kFractionBits) / 3;
+        static constexpr auto kTwiddles_ = basic::createFixedPointTwiddles<SampleCnt, DirectionFactor, Complex>(
+            std::make_index_sequence<SampleCnt::value / 2>{});
+
+    public:
+        void operator()(Complex* data) const
+        {
+            apply(data);
+        }
+
+        /** Runs the FFT in place. The result is bit reversed.
+            \param[in, out] data ... Pointer to an array of SampleCnt elements of type Complex.
+            \return int ... The block exponent: the count of bits the data has been shifted right.
+        */
+        int apply(Complex* data) const
+        {
+            WideType maximum = 0;
+            for (std::size_t i = 0; i < SampleCnt::value; ++i)
+                maximum = std::max(maximum, basic::maximumAbs(data[i]));
+
+            int blockExponent = 0;
+
+            // dualNodeDistance is the distance between elements (successive nodes) of a dual tuple: N/2, N/4, ...
+            for (std::size_t dualNodeDistance = SampleCnt::value >> 1; dualNodeDistance > 0; dualNodeDistance >>= 1)
+            {
+                auto shift = basic::calculateBlockShift(maximum, kHeadroomLimit_);
+                auto twiddleStride = SampleCnt::value / (dualNodeDistance << 1);
+                blockExponent += shift;
+                maximum = 0;
+
+                for (std::size_t groupNodeIdx = 0; groupNodeIdx < SampleCnt::value; groupNodeIdx += dualNodeDistance << 1)
+                {
+                    for (std::size_t r = 0; r < dualNodeDistance; ++r)
+                    {
+                        auto idxNode0 = groupNodeIdx + r;
+                        auto idxNode1 = idxNode0 + dualNodeDistance;
+                        // DIF radix-2 butterfly:
+                        // g[l] = x[l] + x[l + N/2]
+                        // h[l] = (x[l] - x[l + N/2]) * W^l
+                        auto node0 = basic::shiftRight(data[idxNode0], shift);
+                        auto node1 = basic::shiftRight(data[idxNode1], shift);
+
+                        data[idxNode0] = node0 + node1;
+                        data[idxNode1] = basic::multiply(node0 - node1, kTwiddles_[r * twiddleStride]);
+
+                        maximum = std::max({maximum, basic::maximumAbs(data[idxNode0]), basic::maximumAbs(data[idxNode1])});
+                    }
+                }
+            }
+
+            return blockExponent;
+        }
+    };
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include "../basic/FixedPoint.h"
+#include <type_traits>
+#include <utility>
+#include "../SubTask.h"
+
+namespace jeanbaptiste::core
+{
+    /** Performs a radix 4 decimation in time FFT on complex numbers in Q format (basic::ComplexQ15, basic::ComplexQ31).
+        The butterflies equal the ones of Radix4DIT, so that bit reversal is used instead of digit reversal.
+        The stages are processed iteratively, so that block floating point scaling is applied per stage: the maximum of each
+        stage's output is tracked and the next stage shifts its inputs right as long as the maximum may overflow.
+        The result is the DFT scaled by 2^-blockExponent. The twiddle factors are created at compilation time.
+        \param SampleCnt ... The count of samples.
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The fixed point complex type.
+    */
+    template<typename SampleCnt,
+             typename DirectionFactor,
+             typename Complex>
+    class FixedPointRadix4DIT
+        : public SubTask<FixedPointRadix4DIT<SampleCnt, DirectionFactor, Complex>,
+                         Complex>
+    {
+        using Integer = typename Complex::value_type;
+        using WideType = typename basic::FixedPointFormat<Integer>::WideType;
+
+        // A butterfly's output grows by 1 + 3 * sqrt(2) in the worst case, which stays below full scale for inputs below 1/6.
+        static constexpr WideType kHeadroomLimit_ = (WideType{1} << basic::FixedPointFormat<Integer>::kFractionBits) / 6;
+        // W^r, W^2r and W^3r with r < N/4 are needed.
+        static constexpr auto kTwiddles_ = basic::createFixedPointTwiddles<SampleCnt, DirectionFactor, Complex>(
+            std::make_index_sequence<SampleCnt::value * 3 / 4>{});
+
+    public:
+        void operator()(Complex* data) const
+        {
+            apply(data);
+        }
+
+        /** Runs the FFT in place on bit reversed data.
+            \param[in, out] data ... Pointer to an array of SampleCnt elements of type Complex.
+            \return int ... The block exponent: the count of bits the data has been shifted right.
+        */
+        int apply(Complex* data) const
+        {
+            WideType maximum = 0;
+            for (std::size_t i = 0; i < SampleCnt::value; ++i)
+                maximum = std::max(maximum, basic::maximumAbs(data[i]));
+
+            int blockExponent = 0;
+
+            // quaternaryNodeDistance is the distance between elements (successive nodes) of a quaternary tuple: 1, 4, 16, ...
+            for (std::size_t quaternaryNodeDistance = 1; quaternaryNodeDistance < SampleCnt::value; quaternaryNodeDistance <<= 2)
+            {
+                auto shift = basic::calculateBlockShift(maximum, kHeadroomLimit_);
+                auto twiddleStride = SampleCnt::value / (quaternaryNodeDistance << 2);
+                blockExponent += shift;
+                maximum = 0;
+
+                for (std::size_t groupNodeIdx = 0; groupNodeIdx < SampleCnt::value; groupNodeIdx += quaternaryNodeDistance << 2)
+                {
+                    for (std::size_t r = 0; r < quaternaryNodeDistance; ++r)
+                    {
+                        auto idxNode0 = groupNodeIdx + r;
+                        auto idxNode1 = idxNode0 + quaternaryNodeDistance;
+                        auto idxNode2 = idxNode1 + quaternaryNodeDistance;
+                        auto idxNode3 = idxNode2 + quaternaryNodeDistance;
+
+                        // DIT radix-4 butterfly of Radix4DIT, customized for bit reversal (Sidney Burrus).
+                        auto temp1 = basic::shiftRight(data[idxNode0], shift);
+                        auto temp2 = basic::multiply(basic::shiftRight(data[idxNode2], shift), kTwiddles_[r * twiddleStride]);
+                        auto temp3 = basic::multiply(basic::shiftRight(data[idxNode1], shift), kTwiddles_[2 * r * twiddleStride]);
+                        auto temp4 = basic::multiply(basic::shiftRight(data[idxNode3], shift), kTwiddles_[3 * r * twiddleStride]);
+
+                        auto sum13 = temp1 + temp3;
+                        auto difference13 = temp1 - temp3;
+                        auto sum24 = temp2 + temp4;
+                        auto rotatedDifference24 = basic::rotate<DirectionFactor>(temp2 - temp4);
+
+                        data[idxNode0] = sum13 + sum24;
+                        data[idxNode1] = difference13 + rotatedDifference24;
+                        data[idxNode2] = sum13 - sum24;
+                        data[idxNode3] = difference13 - rotatedDifference24;
+
+                        maximum = std::max({maximum,
+                            basic::maximumAbs(data[idxNode0]), basic::maximumAbs(data[idxNode1]),
+                            basic::maximumAbs(data[idxNode2]), basic::maximumAbs(data[idxNode3])});
+                    }
+                }
+            }
+
+            return blockExponent;
+        }
+    };
+
+    /** Performs a radix 4 decimation in frequency FFT on complex numbers in Q format (basic::ComplexQ15, basic::ComplexQ31).
+        The butterflies equal the ones of Radix4DIF, so that bit reversal is used instead of digit reversal.
+        The stages are processed iteratively, so that block floating point scaling is applied per stage: the maximum of each
+        stage's output is tracked and the next stage shifts its inputs right as long as the maximum may overflow.
+        The result is the bit reversed DFT scaled by 2^-blockExponent. The twiddle factors are created at compilation time.
+        \param SampleCnt ... The count of samples.
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The fixed point complex type.
+    */
+    template<typename SampleCnt,
+             typename DirectionFactor,
+             typename Complex>
+    class FixedPointRadix4DIF
+        : public SubTask<FixedPointRadix4DIF<SampleCnt, DirectionFactor, Complex>,
+                         Complex>
+    {
+        using Integer = typename Complex::value_type;
+        using WideType = typename basic::FixedPointFormat<Integer>::WideType;
+
+        // A butterfly's output grows by 4 * sqrt(2) in the worst case, which stays below full scale for inputs below 1/6.
+        static constexpr WideType kHeadroomLimit_ = (WideType{1} << basic::FixedPointFormat<Integer>::kFractionBits) / 6;
+        // W^r, W^2r and W^3r with r < N/4 are needed.
+        static constexpr auto kTwiddles_ = basic::createFixedPointTwiddles<SampleCnt, DirectionFactor, Complex>(
+            std::make_index_sequence<SampleCnt::value * 3 / 4>{});
+
+    public:
+        void operator()(Complex* data) const
+        {
+            apply(data);
+        }
+
+        /** Runs the FFT in place. The result is bit reversed.
+            \param[in, out] data ... Pointer to an array of SampleCnt elements of type Complex.
+            \return int ... The block exponent: the count of bits the data has been shifted right.
+        */
+        int apply(Complex* data) const
+        {
+            WideType maximum = 0;
+            for (std::size_t i = 0; i < SampleCnt::value; ++i)
+                maximum = std::max(maximum, basic::maximumAbs(data[i]));
+
+            int blockExponent = 0;
+
+            // quaternaryNodeDistance is the distance between elements (successive nodes) of a quaternary tuple: N/4, N/16, ...
+            for (std::size_t quaternaryNodeDistance = SampleCnt::value >> 2; quaternaryNodeDistance > 0; quaternaryNodeDistance >>= 2)
+            {
+                auto shift = basic::calculateBlockShift(maximum, kHeadroomLimit_);
+                auto twiddleStride = SampleCnt::value / (quaternaryNodeDistance << 2);
+                blockExponent += shift;
+                maximum = 0;
+
+                for (std::size_t groupNodeIdx = 0; groupNodeIdx < SampleCnt::value; groupNodeIdx += quaternaryNodeDistance << 2)
+                {
+                    for (std::size_t r = 0; r < quaternaryNodeDistance; ++r)
+                    {
+                        auto idxNode0 = groupNodeIdx + r;
+                        auto idxNode1 = idxNode0 + quaternaryNodeDistance;
+                        auto idxNode2 = idxNode1 + quaternaryNodeDistance;
+                        auto idxNode3 = idxNode2 + quaternaryNodeDistance;
+
+                        // DIF radix-4 butterfly of Radix4DIF, customized for bit reversal (Sidney Burrus).
+                        auto node0 = basic::shiftRight(data[idxNode0], shift);
+                        auto node1 = basic::shiftRight(data[idxNode1], shift);
+                        auto node2 = basic::shiftRight(data[idxNode2], shift);
+                        auto node3 = basic::shiftRight(data[idxNode3], shift);
+
+                        auto temp1 = node0 + node2;
+                        auto temp2 = node0 - node2;
+                        auto temp3 = node1 + node3;
+                        auto rotatedTemp4 = basic::rotate<DirectionFactor>(node1 - node3);
+
+                        data[idxNode0] = temp1 + temp3;
+                        data[idxNode1] = basic::multiply(temp1 - temp3, kTwiddles_[2 * r * twiddleStride]);
+                        data[idxNode2] = basic::multiply(temp2 + rotatedTemp4, kTwiddles_[r * twiddleStride]);
+                        data[idxNode3] = basic::multiply(temp2 - rotatedTemp4, kTwiddles_[3 * r * twiddleStride]);
+
+                        maximum = std::max({maximum,
+                            basic::maximumAbs(data[idxNode0]), basic::maximumAbs(data[idxNode1]),
+                            basic::maximumAbs(data[idxNode2]), basic::maximumAbs(data[idxNode3])});
+                    }
+                }
+            }
+
+            return blockExponent;
+        }
+    };
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include "../basic/SineCosine.h"
+#include <boost/math/constants/constants.hpp>
+#include <complex>
+#include "../SubTask.h"
+
+namespace constants = boost::math::constants;
+
+namespace jeanbaptiste::core
+{
+    /** Calculates selected DFT bins using the Goertzel algorithm. Each bin costs one real by complex multiplication and two
+        complex additions per sample: O(N) per bin instead of O(N log N) for all bins.
+        The recursion coefficients are created at compilation time. All bins are calculated within a single pass over the data.
+        The results match the corresponding output bins of the FFT algorithms of the same direction.
+        \param SampleCnt ... The count of samples.
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The complex type.
+        \param Bins ... The indices of the bins to be calculated: 0 ... SampleCnt - 1.
+    */
+    template<typename SampleCnt,
+             typename DirectionFactor,
+             typename Complex,
+             int... Bins>
+    class Goertzel
+        : public SubTask<Goertzel<SampleCnt, DirectionFactor, Complex, Bins...>,
+                         Complex>
+    {
+        static_assert(sizeof...(Bins) > 0, "Trying to calculate no bins at all.");
+        static_assert(((Bins >= 0 && Bins < SampleCnt::value) && ...), "Trying to calculate a bin outside of [0, sample count).");
+
+        using ValueType = typename Complex::value_type;
+
+        static constexpr std::size_t kBinCnt_ = sizeof...(Bins);
+
+        static constexpr double getAngle(const int bin)
+        {
+            return 2.0 * constants::pi<double>() * bin / SampleCnt::value;
+        }
+
+        static constexpr std::array<int, kBinCnt_> kBins_ = {Bins...};
+        // Recursion coefficients 2 * cos(w).
+        static constexpr std::array<ValueType, kBinCnt_> kCoefficients_ =
+        {
+            static_cast<ValueType>(2.0 * basic::cosine<double>(getAngle(Bins)))...
+        };
+        // Final rotations e^(-j * DirectionFactor * w).
+        static constexpr std::array<Complex, kBinCnt_> kRotations_ =
+        {
+            Complex(
+                static_cast<ValueType>(basic::cosine<double>(getAngle(Bins))),
+                static_cast<ValueType>(-DirectionFactor::value * basic::sine<double>(getAngle(Bins))))...
+        };
+
+    public:
+        /** Calculates the selected bins in place. Bin k is written to data[k], all other elements keep their input values.
+            \param[in, out] data ... Pointer to an array of SampleCnt elements of type Complex.
+        */
+        void operator()(Complex* data) const
+        {
+            std::array<Complex, kBinCnt_> bins;
+            operator()(data, &bins[0]);
+
+            for (std::size_t j = 0; j < kBinCnt_; ++j)
+                data[kBins_[j]] = bins[j];
+        }
+
+        /** Calculates the selected bins.
+            \param[in] data ... Pointer to an array of SampleCnt elements of type Complex.
+            \param[out] bins ... Pointer to an array of sizeof...(Bins) elements receiving the bins in the order of Bins.
+        */
+        void operator()(const Complex* data, Complex* bins) const
+        {
+            // Recursion states s[n - 1] and s[n - 2] of all bins.
+            std::array<Complex, kBinCnt_> state1{};
+            std::array<Complex, kBinCnt_> state2{};
+
+            // s[n] = x[n] + 2 * cos(w) * s[n - 1] - s[n - 2]
+            for (std::size_t n = 0; n < SampleCnt::value; ++n)
+            {
+                for (std::size_t j = 0; j < kBinCnt_; ++j)
+                {
+                    Complex state0 = data[n] + kCoefficients_[j] * state1[j] - state2[j];
+                    state2[j] = state1[j];
+                    state1[j] = state0;
+                }
+            }
+
+            // X[k] = e^(-j * DirectionFactor * w) * s[N - 1] - s[N - 2]
+            for (std::size_t j = 0; j < kBinCnt_; ++j)
+                bins[j] = kRotations_[j] * state1[j] - state2[j];
+        }
+
+        static constexpr std::size_t numberOfBins(void)
+        {
+            return kBinCnt_;
+        }
+
+        static constexpr int bin(const std::size_t index)
+        {
+            return kBins_[index];
+        }
+    };
+}
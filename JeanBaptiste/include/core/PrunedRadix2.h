@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include "../basic/SineCosine.h"
+#include <boost/math/constants/constants.hpp>
+#include <complex>
+#include "../SubTask.h"
+
+namespace constants = boost::math::constants;
+
+namespace jeanbaptiste::core
+{
+    /** Performs a pruned radix 2 decimation in time FFT using template metaprogramming.
+        Butterflies are skipped whose inputs are known to be zero or whose outputs are not needed:
+        - Only the first InputCnt samples (in natural order, before bit reversal) may be non zero. All others have to be zero.
+        - Only the first OutputCnt frequencies are calculated. All others are undefined.
+        With InputCnt = OutputCnt = SampleCnt the result equals the one of Radix2DIT.
+        \param SampleCnt ... The count of samples to be processed in this recursion level (stage)
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The complex type.
+        \param InputCnt ... The count of leading samples which may be non zero in this recursion level.
+        \param OutputCnt ... The count of leading frequencies which are needed from this recursion level.
+    */
+    template<typename SampleCnt,
+             typename DirectionFactor,
+             typename Complex,
+             typename InputCnt,
+             typename OutputCnt>
+    class PrunedRadix2DIT
+        : public SubTask<PrunedRadix2DIT<SampleCnt, DirectionFactor, Complex, InputCnt, OutputCnt>,
+                         Complex>
+    {
+        static constexpr unsigned kHalfSampleCnt_ = SampleCnt::value >> 1;
+        static constexpr unsigned kInputCnt_ = std::min<unsigned>(InputCnt::value, SampleCnt::value);
+        static constexpr unsigned kOutputCnt_ = std::min<unsigned>(OutputCnt::value, SampleCnt::value);
+        // The first half holds the even samples, the second half the odd samples.
+        static constexpr unsigned kEvenInputCnt_ = (kInputCnt_ + 1) >> 1;
+        static constexpr unsigned kOddInputCnt_ = kInputCnt_ >> 1;
+        // X[r] and X[r + N/2] are both calculated from G[r] and H[r].
+        static constexpr unsigned kHalfOutputCnt_ = std::min(kOutputCnt_, kHalfSampleCnt_);
+        static constexpr unsigned kUpperOutputCnt_ = (kOutputCnt_ > kHalfSampleCnt_) ? kOutputCnt_ - kHalfSampleCnt_ : 0;
+
+        PrunedRadix2DIT<std::integral_constant<unsigned, kHalfSampleCnt_>, DirectionFactor, Complex,
+            std::integral_constant<unsigned, kEvenInputCnt_>, std::integral_constant<unsigned, kHalfOutputCnt_>> evenRecursionLevel_;
+        PrunedRadix2DIT<std::integral_constant<unsigned, kHalfSampleCnt_>, DirectionFactor, Complex,
+            std::integral_constant<unsigned, kOddInputCnt_>, std::integral_constant<unsigned, kHalfOutputCnt_>> oddRecursionLevel_;
+
+    public:
+        void operator()(Complex* data) const
+        {
+            apply(data);
+        }
+
+        void apply(Complex* data, unsigned groupNodeIdx = 0) const
+        {
+            using ValueType = typename Complex::value_type;
+
+            // All samples are zero or no frequency is needed.
+            if constexpr (kInputCnt_ == 0 || kOutputCnt_ == 0)
+                return;
+
+            evenRecursionLevel_.apply(data, groupNodeIdx);
+            oddRecursionLevel_.apply(data, groupNodeIdx + kHalfSampleCnt_);
+
+            if constexpr (kOddInputCnt_ == 0)
+            {
+                // H[r] is zero: X[r] = X[r + N/2] = G[r].
+                for (auto idxNode0 = groupNodeIdx; idxNode0 < groupNodeIdx + kUpperOutputCnt_; ++idxNode0)
+                    data[idxNode0 + kHalfSampleCnt_] = data[idxNode0];
+            }
+            else
+            {
+                // Create twiddle factor multiplier for trigonometric recurrence.
+                constexpr Complex twiddleMultiplier(
+                    static_cast<ValueType>(-2.0 * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>()) * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>())),
+                    static_cast<ValueType>(DirectionFactor::value * basic::sine<ValueType>(2.0 / SampleCnt::value * constants::pi<ValueType>())));
+                // Create transform factor.
+                Complex twiddleFactor(1.0, 0.0);
+
+                // Run through the dual nodes of the needed frequencies only.
+                for (auto idxNode0 = groupNodeIdx, idxEnd = (groupNodeIdx + kHalfOutputCnt_); idxNode0 < idxEnd; ++idxNode0)
+                {
+                    auto idxNode1 = idxNode0 + kHalfSampleCnt_;
+                    // DIT radix-2 butterfly:
+                    // X[r]          = G[r] + H[r] * W^r
+                    // X[r + N/2]    = G[r] - H[r] * W^r
+                    Complex product(twiddleFactor * data[idxNode1]);
+                    if (idxNode0 < groupNodeIdx + kUpperOutputCnt_)
+                        data[idxNode1] = data[idxNode0] - product;
+                    data[idxNode0] += product;
+
+                    // Calculate the next transform factor via trigonometric recurrence.
+                    if ((idxNode0 + 1) < idxEnd)
+                        twiddleFactor += twiddleMultiplier * twiddleFactor;
+                }
+            }
+        }
+    };
+
+    /** Specialization for case SampleCnt=1.
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The complex type.
+    */
+    template<typename DirectionFactor,
+             typename Complex,
+             typename InputCnt,
+             typename OutputCnt>
+    class PrunedRadix2DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, InputCnt, OutputCnt>
+        : public SubTask<PrunedRadix2DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, InputCnt, OutputCnt>,
+                         Complex>
+    {
+    public:
+        void operator()(Complex* data) const
+        {
+            apply(data);
+        }
+
+        void apply(Complex*, unsigned int = 0) const
+        {}
+    };
+
+
+    /** Performs a pruned radix 2 decimation in frequency FFT using template metaprogramming.
+        Butterflies are skipped whose inputs are known to be zero or whose outputs are not needed:
+        - Only the first InputCnt samples may be non zero. All others have to be zero.
+        - Only the first OutputCnt frequencies (in natural order, after bit reversal) are calculated. All others are undefined.
+        With InputCnt = OutputCnt = SampleCnt the result equals the one of Radix2DIF.
+        \param SampleCnt ... The count of samples to be processed in this recursion level (stage)
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The complex type.
+        \param InputCnt ... The count of leading samples which may be non zero in this recursion level.
+        \param OutputCnt ... The count of leading frequencies which are needed from this recursion level.
+    */
+    template<typename SampleCnt,
+             typename DirectionFactor,
+             typename Complex,
+             typename InputCnt,
+             typename OutputCnt>
+    class PrunedRadix2DIF
+        : public SubTask<PrunedRadix2DIF<SampleCnt, DirectionFactor, Complex, InputCnt, OutputCnt>,
+                         Complex>
+    {
+        static constexpr unsigned kHalfSampleCnt_ = SampleCnt::value >> 1;
+        static constexpr unsigned kInputCnt_ = std::min<unsigned>(InputCnt::value, SampleCnt::value);
+        static constexpr unsigned kOutputCnt_ = std::min<unsigned>(OutputCnt::value, SampleCnt::value);
+        // g[l] = x[l] + x[l + N/2] and h[l] = (x[l] - x[l + N/2]) * W^l have the same count of leading non zero samples.
+        static constexpr unsigned kHalfInputCnt_ = std::min(kInputCnt_, kHalfSampleCnt_);
+        // The first half produces the even frequencies, the second half the odd frequencies.
+        static constexpr unsigned kEvenOutputCnt_ = (kOutputCnt_ + 1) >> 1;
+        static constexpr unsigned kOddOutputCnt_ = kOutputCnt_ >> 1;
+
+        PrunedRadix2DIF<std::integral_constant<unsigned, kHalfSampleCnt_>, DirectionFactor, Complex,
+            std::integral_constant<unsigned, kHalfInputCnt_>, std::integral_constant<unsigned, kEvenOutputCnt_>> evenRecursionLevel_;
+        PrunedRadix2DIF<std::integral_constant<unsigned, kHalfSampleCnt_>, DirectionFactor, Complex,
+            std::integral_constant<unsigned, kHalfInputCnt_>, std::integral_constant<unsigned, kOddOutputCnt_>> oddRecursionLevel_;
+
+    public:
+        void operator()(Complex* data) const
+        {
+            apply(data);
+        }
+
+        void apply(Complex* data, unsigned groupNodeIdx = 0) const
+        {
+            using ValueType = typename Complex::value_type;
+
+            // All samples are zero or no frequency is needed.
+            if constexpr (kInputCnt_ == 0 || kOutputCnt_ == 0)
+                return;
+
+            if constexpr (kOddOutputCnt_ == 0)
+            {
+                // h[l] is not needed: only g[l] = x[l] + x[l + N/2].
+                if constexpr (kInputCnt_ > kHalfSampleCnt_)
+                    for (auto idxNode0 = groupNodeIdx; idxNode0 < groupNodeIdx + kHalfSampleCnt_; ++idxNode0)
+                        data[idxNode0] += data[idxNode0 + kHalfSampleCnt_];
+            }
+            else
+            {
+                // Create twiddle factor multiplier for trigonometric recurrence.
+                constexpr Complex twiddleMultiplier(
+                    static_cast<ValueType>(-2.0 * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>()) * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>())),
+                    static_cast<ValueType>(DirectionFactor::value * basic::sine<ValueType>(2.0 / SampleCnt::value * constants::pi<ValueType>())));
+                // Create transform factor.
+                Complex twiddleFactor(1.0, 0.0);
+
+                // Run through the dual nodes of non zero samples only. Both nodes of all other dual nodes are zero.
+                for (auto idxNode0 = groupNodeIdx, idxEnd = (groupNodeIdx + kHalfInputCnt_); idxNode0 < idxEnd; ++idxNode0)
+                {
+                    auto idxNode1 = idxNode0 + kHalfSampleCnt_;
+                    // DIF radix-2 butterfly:
+                    // g[l] = x[l] + x[l + N/2]
+                    // h[l] = (x[l] - x[l + N/2]) * W^l
+                    // If x[l + N/2] is zero: g[l] = x[l], h[l] = x[l] * W^l
+                    if constexpr (kInputCnt_ > kHalfSampleCnt_)
+                    {
+                        auto sum(data[idxNode0] + data[idxNode1]);
+                        data[idxNode1] = (data[idxNode0] - data[idxNode1]) * twiddleFactor;
+                        data[idxNode0] = sum;
+                    }
+                    else
+                        data[idxNode1] = data[idxNode0] * twiddleFactor;
+
+                    // Calculate the next transform factor via trigonometric recurrence.
+                    if ((idxNode0 + 1) < idxEnd)
+                        twiddleFactor += twiddleMultiplier * twiddleFactor;
+                }
+            }
+
+            evenRecursionLevel_.apply(data, groupNodeIdx);
+            oddRecursionLevel_.apply(data, groupNodeIdx + kHalfSampleCnt_);
+        }
+    };
+
+    /** Specialization for case SampleCnt=1.
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The complex type.
+    */
+    template<typename DirectionFactor,
+             typename Complex,
+             typename InputCnt,
+             typename OutputCnt>
+    class PrunedRadix2DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, InputCnt, OutputCnt>
+        : public SubTask<PrunedRadix2DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, InputCnt, OutputCnt>,
+                         Complex>
+    {
+    public:
+        void operator()(Complex* data) const
+        {
+            apply(data);
+        }
+
+        void apply(Complex*, unsigned int = 0) const
+        {}
+    };
+}
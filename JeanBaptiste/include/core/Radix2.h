@@ -13,15 +13,18 @@ namespace jeanbaptiste::core
         \param SampleCnt ... The count of samples to be processed in this recursion level (stage)
         \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
         \param Complex ... The complex type.
+        \param TwiddleComplex ... The complex type the twiddle factors are calculated in. std::complex<double> keeps the
+                                  trigonometric recurrence accurate for float data (mixed precision).
     */
     template<typename SampleCnt,
              typename DirectionFactor,
-             typename Complex>
+             typename Complex,
+             typename TwiddleComplex = Complex>
     class Radix2DIT
-        : public SubTask<Radix2DIT<SampleCnt, DirectionFactor, Complex>,
+        : public SubTask<Radix2DIT<SampleCnt, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
-        Radix2DIT<std::integral_constant<unsigned, SampleCnt::value / 2>, DirectionFactor, Complex> recursionLevel_;
+        Radix2DIT<std::integral_constant<unsigned, SampleCnt::value / 2>, DirectionFactor, Complex, TwiddleComplex> recursionLevel_;
 
     public:
         void operator()(Complex* data) const
@@ -31,7 +34,7 @@ namespace jeanbaptiste::core
 
         void apply(Complex* data, unsigned groupNodeIdx = 0) const
         {
-            using ValueType = typename Complex::value_type;
+            using TwiddleValueType = typename TwiddleComplex::value_type;
 
             // dualNodeDistance is the distance between elements (successive nodes) of a 
             // dual tuple, e.g. ..., 8, 4, 2, 1.
@@ -42,11 +45,11 @@ namespace jeanbaptiste::core
             recursionLevel_.apply(data, groupNodeIdx + dualNodeDistance);
 
             // Create twiddle factor multiplier for trigonometric recurrence.
-            constexpr Complex twiddleMultiplier(
-                static_cast<ValueType>(-2.0 * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>()) * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>())),
-                static_cast<ValueType>(DirectionFactor::value * basic::sine<ValueType>(2.0 / SampleCnt::value * constants::pi<ValueType>())));
+            constexpr TwiddleComplex twiddleMultiplier(
+                static_cast<TwiddleValueType>(-2.0 * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>()) * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>())),
+                static_cast<TwiddleValueType>(DirectionFactor::value * basic::sine<TwiddleValueType>(2.0 / SampleCnt::value * constants::pi<TwiddleValueType>())));
             // Create transform factor.
-            Complex twiddleFactor(1.0, 0.0);
+            TwiddleComplex twiddleFactor(1.0, 0.0);
 
             // Run through dual nodes within the current group.
             for (auto idxNode0 = groupNodeIdx, idxEnd = (groupNodeIdx + dualNodeDistance); idxNode0 < idxEnd; ++idxNode0)
@@ -62,7 +65,7 @@ namespace jeanbaptiste::core
                 //
                 // node1: add prod of node2 and twiddle factor.
                 // node2: diff of node1 - prod of node2 and twiddle factor.
-                Complex product(twiddleFactor * data[idxNode1]);
+                Complex product(Complex(twiddleFactor) * data[idxNode1]);
                 data[idxNode1]  = data[idxNode0] - product;
                 data[idxNode0] += product;
 
@@ -76,9 +79,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=1 (forward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class Radix2DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>
-        : public SubTask<Radix2DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class Radix2DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>
+        : public SubTask<Radix2DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -123,9 +127,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=-1 (backward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class Radix2DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>
-        : public SubTask<Radix2DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class Radix2DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>
+        : public SubTask<Radix2DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -173,9 +178,10 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class Radix2DIT<std::integral_constant<unsigned, 2>, DirectionFactor, Complex>
-        : public SubTask<Radix2DIT<std::integral_constant<unsigned, 2>, DirectionFactor, Complex>,
+             typename Complex,
+             typename TwiddleComplex>
+    class Radix2DIT<std::integral_constant<unsigned, 2>, DirectionFactor, Complex, TwiddleComplex>
+        : public SubTask<Radix2DIT<std::integral_constant<unsigned, 2>, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -199,9 +205,10 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class Radix2DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>
-        : public SubTask<Radix2DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>,
+             typename Complex,
+             typename TwiddleComplex>
+    class Radix2DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>
+        : public SubTask<Radix2DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -219,15 +226,18 @@ namespace jeanbaptiste::core
         \param SampleCnt ... The count of samples to be processed in this recursion level (stage)
         \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
         \param Complex ... The complex type.
+        \param TwiddleComplex ... The complex type the twiddle factors are calculated in. std::complex<double> keeps the
+                                  trigonometric recurrence accurate for float data (mixed precision).
     */
     template<typename SampleCnt,
              typename DirectionFactor,
-             typename Complex>
+             typename Complex,
+             typename TwiddleComplex = Complex>
     class Radix2DIF
-        : public SubTask<Radix2DIF<SampleCnt, DirectionFactor, Complex>,
+        : public SubTask<Radix2DIF<SampleCnt, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
-        Radix2DIF<std::integral_constant<unsigned, SampleCnt::value / 2>, DirectionFactor, Complex> recursionLevel_;
+        Radix2DIF<std::integral_constant<unsigned, SampleCnt::value / 2>, DirectionFactor, Complex, TwiddleComplex> recursionLevel_;
 
     public:
         void operator()(Complex* data) const
@@ -237,18 +247,18 @@ namespace jeanbaptiste::core
 
         void apply(Complex* data, unsigned groupNodeIdx = 0) const
         {
-            using ValueType = typename Complex::value_type;
+            using TwiddleValueType = typename TwiddleComplex::value_type;
 
             // dualNodeDistance is the distance between elements (successive nodes) of a 
             // dual tuple, e.g. ..., 8, 4, 2, 1.
             auto dualNodeDistance = SampleCnt::value >> 1;
 
             // Create twiddle factor multiplier for trigonometric recurrence.
-            constexpr Complex twiddleMultiplier(
-                static_cast<ValueType>(-2.0 * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>()) * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>())),
-                static_cast<ValueType>(DirectionFactor::value * basic::sine<ValueType>(2.0 / SampleCnt::value * constants::pi<ValueType>())));
+            constexpr TwiddleComplex twiddleMultiplier(
+                static_cast<TwiddleValueType>(-2.0 * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>()) * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>())),
+                static_cast<TwiddleValueType>(DirectionFactor::value * basic::sine<TwiddleValueType>(2.0 / SampleCnt::value * constants::pi<TwiddleValueType>())));
             // Create transform factor.
-            Complex twiddleFactor(1.0, 0.0);
+            TwiddleComplex twiddleFactor(1.0, 0.0);
 
             // Run through dual nodes within the current group.
             for (auto idxNode0 = groupNodeIdx, idxEnd = (groupNodeIdx + dualNodeDistance); idxNode0 < idxEnd; ++idxNode0)
@@ -265,7 +275,7 @@ namespace jeanbaptiste::core
                 // node1: sum of node1 and node2.
                 // node2: (diff off node1 - node2) * twiddle factor.
                 auto sum(data[idxNode0] + data[idxNode1]);
-                data[idxNode1] = (data[idxNode0] - data[idxNode1]) * twiddleFactor;
+                data[idxNode1] = (data[idxNode0] - data[idxNode1]) * Complex(twiddleFactor);
                 data[idxNode0] = sum;
 
                 // Calculate the next transform factor via trigonometric recurrence.
@@ -282,9 +292,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=1 (forward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class Radix2DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>
-        : public SubTask<Radix2DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class Radix2DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>
+        : public SubTask<Radix2DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -329,9 +340,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=-1 (backward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class Radix2DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>
-        : public SubTask<Radix2DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class Radix2DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>
+        : public SubTask<Radix2DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -378,9 +390,10 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class Radix2DIF<std::integral_constant<unsigned, 2>, DirectionFactor, Complex>
-        : public SubTask<Radix2DIF<std::integral_constant<unsigned, 2>, DirectionFactor, Complex>,
+             typename Complex,
+             typename TwiddleComplex>
+    class Radix2DIF<std::integral_constant<unsigned, 2>, DirectionFactor, Complex, TwiddleComplex>
+        : public SubTask<Radix2DIF<std::integral_constant<unsigned, 2>, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -404,9 +417,10 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class Radix2DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>
-        : public SubTask<Radix2DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>,
+             typename Complex,
+             typename TwiddleComplex>
+    class Radix2DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>
+        : public SubTask<Radix2DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -11,15 +11,18 @@ namespace jeanbaptiste::core
         \param SampleCnt ... The count of samples to be processed in this recursion level (stage)
         \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
         \param Complex ... The complex type.
+        \param TwiddleComplex ... The complex type the twiddle factors are calculated in. std::complex<double> keeps the
+                                  trigonometric recurrence accurate for float data (mixed precision).
     */
     template<typename SampleCnt,
              typename DirectionFactor,
-             typename Complex>
+             typename Complex,
+             typename TwiddleComplex = Complex>
     class Radix4DIT
-        : public SubTask<Radix4DIT<SampleCnt, DirectionFactor, Complex>,
+        : public SubTask<Radix4DIT<SampleCnt, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
-        Radix4DIT<std::integral_constant<unsigned, SampleCnt::value / 4>, DirectionFactor, Complex> recursionLevel_;
+        Radix4DIT<std::integral_constant<unsigned, SampleCnt::value / 4>, DirectionFactor, Complex, TwiddleComplex> recursionLevel_;
 
     public:
         void operator()(Complex* data) const
@@ -29,7 +32,7 @@ namespace jeanbaptiste::core
 
         void apply(Complex* data, unsigned groupNodeIdx = 0) const
         {
-            using ValueType = typename Complex::value_type;
+            using TwiddleValueType = typename TwiddleComplex::value_type;
 
             // quaternaryNodeDistance is the distance between elements (successive nodes) of a
             // quaternary tuple, e.g. ... 16, 4, 1.
@@ -42,20 +45,22 @@ namespace jeanbaptiste::core
             recursionLevel_.apply(data, groupNodeIdx + quaternaryNodeDistance * 3);
 
             // Create twiddle factor multiplier for trigonometric recurrence.
-            constexpr Complex twiddleMultiplier(
-                static_cast<ValueType>(-2.0 * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>()) * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>())),
-                static_cast<ValueType>(DirectionFactor::value * basic::sine<ValueType>(2.0 / SampleCnt::value * constants::pi<ValueType>())));
+            constexpr TwiddleComplex twiddleMultiplier(
+                static_cast<TwiddleValueType>(-2.0 * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>()) * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>())),
+                static_cast<TwiddleValueType>(DirectionFactor::value * basic::sine<TwiddleValueType>(2.0 / SampleCnt::value * constants::pi<TwiddleValueType>())));
             // Create transform factor.
-            Complex twiddleFactor(1.0, 0.0);
+            TwiddleComplex twiddleFactor(1.0, 0.0);
 
             // Run through quaternary tuples of the current group. idxNode0 flags the tuple start.
             for (auto idxNode0 = groupNodeIdx, idxEnd = (groupNodeIdx + quaternaryNodeDistance); idxNode0 < idxEnd; ++idxNode0)
             {
                 // Create twiddle factors.
-                ValueType temp = 1.5 - 0.5 * (twiddleFactor.real() * twiddleFactor.real() + twiddleFactor.imag() * twiddleFactor.imag());
-                Complex wn4(twiddleFactor.real() * temp, twiddleFactor.imag() * temp);
-                Complex wn2 = wn4 * wn4;
-                Complex w3n4 = wn2 * wn4;
+                TwiddleValueType temp = 1.5 - 0.5 * (twiddleFactor.real() * twiddleFactor.real() + twiddleFactor.imag() * twiddleFactor.imag());
+                TwiddleComplex twiddleWn4(twiddleFactor.real() * temp, twiddleFactor.imag() * temp);
+                TwiddleComplex twiddleWn2 = twiddleWn4 * twiddleWn4;
+                Complex wn4(twiddleWn4);
+                Complex wn2(twiddleWn2);
+                Complex w3n4(twiddleWn2 * twiddleWn4);
 
                 // Create tuple node indexes.
                 auto idxNode1 = idxNode0 + quaternaryNodeDistance;
@@ -103,9 +108,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=1 (forward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class Radix4DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>
-        : public SubTask<Radix4DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class Radix4DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>
+        : public SubTask<Radix4DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -157,9 +163,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=-1 (backward).
         \param Complex ... The complex type.
     */
-    template<typename  Complex>
-    class Radix4DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>
-		: public SubTask<Radix4DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class Radix4DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>
+		: public SubTask<Radix4DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -213,8 +220,9 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class Radix4DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>
+             typename Complex,
+             typename TwiddleComplex>
+    class Radix4DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>
     {
     public:
 		void operator()(Complex* data) const
@@ -230,15 +238,18 @@ namespace jeanbaptiste::core
         \param SampleCnt ... The count of samples to be processed in this recursion level (stage)
         \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
         \param Complex ... The complex type.
+        \param TwiddleComplex ... The complex type the twiddle factors are calculated in. std::complex<double> keeps the
+                                  trigonometric recurrence accurate for float data (mixed precision).
     */
     template<typename SampleCnt,
              typename DirectionFactor,
-             typename Complex>
+             typename Complex,
+             typename TwiddleComplex = Complex>
     class Radix4DIF
-		: public SubTask<Radix4DIF<SampleCnt, DirectionFactor, Complex>,
+		: public SubTask<Radix4DIF<SampleCnt, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
-        Radix4DIF<std::integral_constant<unsigned, SampleCnt::value / 4>, DirectionFactor, Complex> recursionLevel_;
+        Radix4DIF<std::integral_constant<unsigned, SampleCnt::value / 4>, DirectionFactor, Complex, TwiddleComplex> recursionLevel_;
 
     public:
 		void operator()(Complex* data) const
@@ -248,27 +259,29 @@ namespace jeanbaptiste::core
 
         void apply(Complex* data, unsigned groupNodeIdx = 0) const
         {
-            using ValueType = typename Complex::value_type;
+            using TwiddleValueType = typename TwiddleComplex::value_type;
 
             // quaternaryNodeDistance is the distance between elements (successive nodes) of a
             // quaternary tuple, e.g. ... 16, 4, 1.
             auto quaternaryNodeDistance = SampleCnt::value >> 2;
 
             // Create twiddle factor multiplier for trigonometric recurrence.
-            constexpr Complex twiddleMultiplier(
-				static_cast<ValueType>(-2.0 * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>()) * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>())),
-                static_cast<ValueType>(DirectionFactor::value * basic::sine<ValueType>(2.0 / SampleCnt::value * constants::pi<ValueType>())));
+            constexpr TwiddleComplex twiddleMultiplier(
+				static_cast<TwiddleValueType>(-2.0 * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>()) * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>())),
+                static_cast<TwiddleValueType>(DirectionFactor::value * basic::sine<TwiddleValueType>(2.0 / SampleCnt::value * constants::pi<TwiddleValueType>())));
             // Create transform factor.
-            Complex twiddleFactor(1.0, 0.0);
+            TwiddleComplex twiddleFactor(1.0, 0.0);
 
             // Run through quaternary tuples of the current group. idxNode0 flags the tuple start.
             for (auto idxNode0 = groupNodeIdx, idxEnd = (groupNodeIdx + quaternaryNodeDistance); idxNode0 < idxEnd; ++idxNode0)
             {
                 // Create twiddle factors.
-                ValueType temp = 1.5 - 0.5 * (twiddleFactor.real() * twiddleFactor.real() + twiddleFactor.imag() * twiddleFactor.imag());
-                Complex wn4(twiddleFactor.real() * temp, twiddleFactor.imag() * temp);
-                Complex wn2 = wn4 * wn4;
-                Complex w3n4 = wn2 * wn4;
+                TwiddleValueType temp = 1.5 - 0.5 * (twiddleFactor.real() * twiddleFactor.real() + twiddleFactor.imag() * twiddleFactor.imag());
+                TwiddleComplex twiddleWn4(twiddleFactor.real() * temp, twiddleFactor.imag() * temp);
+                TwiddleComplex twiddleWn2 = twiddleWn4 * twiddleWn4;
+                Complex wn4(twiddleWn4);
+                Complex wn2(twiddleWn2);
+                Complex w3n4(twiddleWn2 * twiddleWn4);
 
                 // Create tuple node indexes.
                 auto idxNode1 = idxNode0 + quaternaryNodeDistance;
@@ -322,9 +335,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=1 (forward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class Radix4DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>
-		: public SubTask<Radix4DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class Radix4DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>
+		: public SubTask<Radix4DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -376,9 +390,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=-1 (backward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class Radix4DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>
-		: public SubTask<Radix4DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class Radix4DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>
+		: public SubTask<Radix4DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -432,9 +447,10 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class Radix4DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>
-		: public SubTask<Radix4DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>,
+             typename Complex,
+             typename TwiddleComplex>
+    class Radix4DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>
+		: public SubTask<Radix4DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -11,15 +11,18 @@ namespace jeanbaptiste::core
         \param SampleCnt ... The count of samples to be processed in this recursion level (stage)
         \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
         \param Complex ... The complex type.
+        \param TwiddleComplex ... The complex type the twiddle factors are calculated in. std::complex<double> keeps the
+                                  trigonometric recurrence accurate for float data (mixed precision).
     */
     template<typename SampleCnt,
              typename DirectionFactor,
-             typename Complex>
+             typename Complex,
+             typename TwiddleComplex = Complex>
     class RadixSplit24DIT
-        : public SubTask<RadixSplit24DIT<SampleCnt, DirectionFactor, Complex>,
+        : public SubTask<RadixSplit24DIT<SampleCnt, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
-        RadixSplit24DIT<std::integral_constant<unsigned, SampleCnt::value / 2>, DirectionFactor, Complex> recursionLevel_;
+        RadixSplit24DIT<std::integral_constant<unsigned, SampleCnt::value / 2>, DirectionFactor, Complex, TwiddleComplex> recursionLevel_;
 
         void executeSimpleRadix2Butterflies(Complex* data) const
         {
@@ -51,7 +54,7 @@ namespace jeanbaptiste::core
 
         void executeRecursion(Complex* data, unsigned groupNodeIdx, unsigned totalSampleCnt) const
         {
-            using ValueType = typename Complex::value_type;
+            using TwiddleValueType = typename TwiddleComplex::value_type;
 
             // Recursion goes down. Calculation starts in the last recursion stage with n nodes and goes down: ..., 8, 4.
             recursionLevel_.executeRecursion(data, groupNodeIdx, totalSampleCnt);
@@ -69,18 +72,19 @@ namespace jeanbaptiste::core
             unsigned dualNodeDistance = SampleCnt::value;
             unsigned quaternaryNodeDistance = SampleCnt::value >> 2;
 
-            constexpr Complex twiddleMultiplier(
-				static_cast<ValueType>(-2.0 * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>()) * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>())),
-                static_cast<ValueType>(DirectionFactor::value * basic::sine<ValueType>(2.0 / SampleCnt::value * constants::pi<ValueType>())));
+            constexpr TwiddleComplex twiddleMultiplier(
+				static_cast<TwiddleValueType>(-2.0 * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>()) * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>())),
+                static_cast<TwiddleValueType>(DirectionFactor::value * basic::sine<TwiddleValueType>(2.0 / SampleCnt::value * constants::pi<TwiddleValueType>())));
             // Create transform factor.
-            Complex twiddleFactor(1.0, 0.0);
+            TwiddleComplex twiddleFactor(1.0, 0.0);
 
             for (unsigned currentGroupIdx = groupNodeIdx, groupIdxEnd = (groupNodeIdx + quaternaryNodeDistance); currentGroupIdx < groupIdxEnd; ++currentGroupIdx)
             {
                 // Create twiddle factors for Radix-4 butterflies x(4n + 1) and x(4n + 3).
-				ValueType temp = 1.5 - 0.5 * (twiddleFactor.real() * twiddleFactor.real() + twiddleFactor.imag() * twiddleFactor.imag());
-                Complex wn4(twiddleFactor.real() * temp, twiddleFactor.imag() * temp);
-                Complex w3n4 = wn4 * wn4 * wn4;
+				TwiddleValueType temp = 1.5 - 0.5 * (twiddleFactor.real() * twiddleFactor.real() + twiddleFactor.imag() * twiddleFactor.imag());
+                TwiddleComplex twiddleWn4(twiddleFactor.real() * temp, twiddleFactor.imag() * temp);
+                Complex wn4(twiddleWn4);
+                Complex w3n4(twiddleWn4 * twiddleWn4 * twiddleWn4);
 
                 auto segmentIdx = currentGroupIdx;
                 auto lShapedNodeDistance = 2 * dualNodeDistance;
@@ -137,9 +141,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=1 (forward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class RadixSplit24DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>
-        : public SubTask<RadixSplit24DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class RadixSplit24DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>
+        : public SubTask<RadixSplit24DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -203,9 +208,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=-1 (backward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class RadixSplit24DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>
-        : public SubTask<RadixSplit24DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class RadixSplit24DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>
+        : public SubTask<RadixSplit24DIT<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -270,9 +276,10 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class RadixSplit24DIT<std::integral_constant<unsigned, 2>, DirectionFactor, Complex>
-        : public SubTask<RadixSplit24DIT<std::integral_constant<unsigned, 2>, DirectionFactor, Complex>,
+             typename Complex,
+             typename TwiddleComplex>
+    class RadixSplit24DIT<std::integral_constant<unsigned, 2>, DirectionFactor, Complex, TwiddleComplex>
+        : public SubTask<RadixSplit24DIT<std::integral_constant<unsigned, 2>, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -291,9 +298,10 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class RadixSplit24DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>
-        : public SubTask<RadixSplit24DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>,
+             typename Complex,
+             typename TwiddleComplex>
+    class RadixSplit24DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>
+        : public SubTask<RadixSplit24DIT<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -312,15 +320,18 @@ namespace jeanbaptiste::core
         \param SampleCnt ... The count of samples to be processed in this recursion level (stage)
         \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
         \param Complex ... The complex type.
+        \param TwiddleComplex ... The complex type the twiddle factors are calculated in. std::complex<double> keeps the
+                                  trigonometric recurrence accurate for float data (mixed precision).
     */
     template<typename SampleCnt,
              typename DirectionFactor,
-             typename Complex>
+             typename Complex,
+             typename TwiddleComplex = Complex>
     class RadixSplit24DIF
-        : public SubTask<RadixSplit24DIF<SampleCnt, DirectionFactor, Complex>,
+        : public SubTask<RadixSplit24DIF<SampleCnt, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
-        RadixSplit24DIF<std::integral_constant<unsigned, SampleCnt::value / 2>, DirectionFactor, Complex> recursionLevel_;
+        RadixSplit24DIF<std::integral_constant<unsigned, SampleCnt::value / 2>, DirectionFactor, Complex, TwiddleComplex> recursionLevel_;
 
         void executeSimpleRadix2Butterflies(Complex* data) const
         {
@@ -352,7 +363,7 @@ namespace jeanbaptiste::core
 
         void executeRecursion(Complex* data, unsigned groupNodeIdx, unsigned totalSampleCnt) const
         {
-            using ValueType = typename Complex::value_type;
+            using TwiddleValueType = typename TwiddleComplex::value_type;
 
             auto n = SampleCnt::value;
             
@@ -369,18 +380,19 @@ namespace jeanbaptiste::core
             auto dualNodeDistance = SampleCnt::value;
             auto quaternaryNodeDistance = SampleCnt::value >> 2;
 
-            constexpr Complex twiddleMultiplier(
-				static_cast<ValueType>(-2.0 * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>()) * basic::sine<ValueType>(1.0 / SampleCnt::value * constants::pi<ValueType>())),
-                static_cast<ValueType>(DirectionFactor::value * basic::sine<ValueType>(2.0 / SampleCnt::value * constants::pi<ValueType>())));
+            constexpr TwiddleComplex twiddleMultiplier(
+				static_cast<TwiddleValueType>(-2.0 * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>()) * basic::sine<TwiddleValueType>(1.0 / SampleCnt::value * constants::pi<TwiddleValueType>())),
+                static_cast<TwiddleValueType>(DirectionFactor::value * basic::sine<TwiddleValueType>(2.0 / SampleCnt::value * constants::pi<TwiddleValueType>())));
             // Create transform factor.
-            Complex twiddleFactor(1.0, 0.0);
+            TwiddleComplex twiddleFactor(1.0, 0.0);
 
             for (unsigned currentGroupIdx = groupNodeIdx, groupIdxEnd = (groupNodeIdx + quaternaryNodeDistance); currentGroupIdx < groupIdxEnd; ++currentGroupIdx)
             {
                 // Create twiddle factors for Radix-4 butterflies x(4n + 1) and x(4n + 3).
-                ValueType temp = 1.5 - 0.5 * (twiddleFactor.real() * twiddleFactor.real() + twiddleFactor.imag() * twiddleFactor.imag());
-                Complex wn4(twiddleFactor.real() * temp, twiddleFactor.imag() * temp);
-                Complex w3n4 = wn4 * wn4 * wn4;
+                TwiddleValueType temp = 1.5 - 0.5 * (twiddleFactor.real() * twiddleFactor.real() + twiddleFactor.imag() * twiddleFactor.imag());
+                TwiddleComplex twiddleWn4(twiddleFactor.real() * temp, twiddleFactor.imag() * temp);
+                Complex wn4(twiddleWn4);
+                Complex w3n4(twiddleWn4 * twiddleWn4 * twiddleWn4);
 
                 auto segmentIdx = currentGroupIdx;
                 auto lShapedNodeDistance = 2 * dualNodeDistance;
@@ -438,9 +450,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=1 (forward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class RadixSplit24DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>
-        : public SubTask<RadixSplit24DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class RadixSplit24DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>
+        : public SubTask<RadixSplit24DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, 1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -501,9 +514,10 @@ namespace jeanbaptiste::core
     /** Specialization for case SampleCnt=4, direction=-1 (backward).
         \param Complex ... The complex type.
     */
-    template<typename Complex>
-    class RadixSplit24DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>
-        : public SubTask<RadixSplit24DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex>,
+    template<typename Complex,
+             typename TwiddleComplex>
+    class RadixSplit24DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>
+        : public SubTask<RadixSplit24DIF<std::integral_constant<unsigned, 4>, std::integral_constant<int, -1>, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -566,9 +580,10 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class RadixSplit24DIF<std::integral_constant<unsigned, 2>, DirectionFactor, Complex>
-        : public SubTask<RadixSplit24DIF<std::integral_constant<unsigned, 2>, DirectionFactor, Complex>,
+             typename Complex,
+             typename TwiddleComplex>
+    class RadixSplit24DIF<std::integral_constant<unsigned, 2>, DirectionFactor, Complex, TwiddleComplex>
+        : public SubTask<RadixSplit24DIF<std::integral_constant<unsigned, 2>, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
@@ -587,9 +602,10 @@ namespace jeanbaptiste::core
         \param Complex ... The complex type.
     */
     template<typename DirectionFactor,
-             typename Complex>
-    class RadixSplit24DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>
-        : public SubTask<RadixSplit24DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex>,
+             typename Complex,
+             typename TwiddleComplex>
+    class RadixSplit24DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>
+        : public SubTask<RadixSplit24DIF<std::integral_constant<unsigned, 1>, DirectionFactor, Complex, TwiddleComplex>,
                          Complex>
     {
     public:
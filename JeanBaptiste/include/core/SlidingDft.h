@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include "../basic/SineCosine.h"
+#include <boost/math/constants/constants.hpp>
+#include <complex>
+#include "Goertzel.h"
+#include "../tools/SampleConversion.h"
+#include <type_traits>
+#include <vector>
+
+namespace constants = boost::math::constants;
+
+namespace jeanbaptiste::core
+{
+    /** Tracks selected DFT bins of the latest SampleCnt samples of a continuous stream using the sliding DFT.
+        Each pushed sample updates each bin in O(1): X[k] = (X[k] - x[n - N] + x[n]) * W^(-k).
+        Rounding errors of the recursion accumulate over time. Therefore the bins are recalculated from the history of samples
+        using Goertzel every resynchronizationInterval samples.
+        The bins match the corresponding output bins of the FFT algorithms of the same direction applied on the latest SampleCnt
+        samples (oldest sample first).
+        \param SampleCnt ... The count of samples the DFT is calculated on.
+        \param DirectionFactor ... Specifies the direction of the DFT (forward: 1, backward: -1)
+        \param Complex ... The complex type.
+        \param Bins ... The indices of the bins to be tracked: 0 ... SampleCnt - 1.
+    */
+    template<typename SampleCnt,
+             typename DirectionFactor,
+             typename Complex,
+             int... Bins>
+    class SlidingDft
+    {
+        using ValueType = typename Complex::value_type;
+
+        static constexpr std::size_t kBinCnt_ = sizeof...(Bins);
+
+        static constexpr double getAngle(const int bin)
+        {
+            return 2.0 * constants::pi<double>() * bin / SampleCnt::value;
+        }
+
+        // Rotations W^(-k) = e^(-j * DirectionFactor * 2 * pi * k / N).
+        static constexpr std::array<Complex, kBinCnt_> kRotations_ =
+        {
+            Complex(
+                static_cast<ValueType>(basic::cosine<double>(getAngle(Bins))),
+                static_cast<ValueType>(-DirectionFactor::value * basic::sine<double>(getAngle(Bins))))...
+        };
+
+        Goertzel<SampleCnt, DirectionFactor, Complex, Bins...> goertzel_;
+        // Mirrored ring buffer of the latest SampleCnt samples (2 * SampleCnt elements).
+        std::vector<Complex> history_;
+        // Position of the oldest sample.
+        std::size_t position_;
+        std::array<Complex, kBinCnt_> bins_;
+        std::size_t resynchronizationInterval_;
+        std::size_t samplesSinceResynchronization_;
+
+    public:
+        /** Creates the tracker. All bins start at zero as if SampleCnt zeros had been pushed.
+            \param[in] resynchronizationInterval ... The count of samples between two recalculations of the bins. 0 disables
+                                                     recalculation.
+        */
+        explicit SlidingDft(const std::size_t resynchronizationInterval = 16 * SampleCnt::value)
+            : history_(SampleCnt::value << 1),
+              position_(0),
+              bins_{},
+              resynchronizationInterval_(resynchronizationInterval),
+              samplesSinceResynchronization_(0)
+        {}
+
+        /** Pushes a block of samples and updates all bins.
+            \param[in] samples ... Pointer to an array of count samples. Either of type Complex or of its value type.
+            \param[in] count ... The count of samples.
+        */
+        template <typename Sample>
+        void push(const Sample* samples, const std::size_t count)
+        {
+            static_assert(std::is_same_v<Sample, Complex> || std::is_same_v<Sample, ValueType>,
+                "Trying to push samples of a type other than the complex type or its value type.");
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                auto value = tools::loadSample<Complex>(samples[i]);
+                auto difference = value - history_[position_];
+
+                history_[position_] = value;
+                history_[position_ + SampleCnt::value] = value;
+                position_ = (position_ + 1 == SampleCnt::value) ? 0 : position_ + 1;
+
+                for (std::size_t j = 0; j < kBinCnt_; ++j)
+                    bins_[j] = (bins_[j] + difference) * kRotations_[j];
+
+                if (resynchronizationInterval_ > 0 && ++samplesSinceResynchronization_ == resynchronizationInterval_)
+                {
+                    // The history starting at the oldest sample is contiguous thanks to the mirrored ring buffer.
+                    goertzel_(&history_[position_], &bins_[0]);
+                    samplesSinceResynchronization_ = 0;
+                }
+            }
+        }
+
+        /** Returns the bin at index in the order of Bins.
+        */
+        Complex bin(const std::size_t index) const
+        {
+            return bins_[index];
+        }
+
+        /** Resets the history and all bins to zero.
+        */
+        void reset(void)
+        {
+            std::fill(history_.begin(), history_.end(), Complex{});
+            bins_.fill(Complex{});
+            position_ = 0;
+            samplesSinceResynchronization_ = 0;
+        }
+
+        static constexpr std::size_t numberOfBins(void)
+        {
+            return kBinCnt_;
+        }
+    };
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <complex>
+#include "../SubTask.h"
+
+namespace jeanbaptiste::normalization
+{
+    /** Conjugates FFT results and normalizes them the same way Normalization does, in a single pass.
+        Used by backward transforms which run the forward core on conjugated data: x[n] = conj(FFT(conj(X[k]))).
+        \param Normalization ... The normalization sub task which provides the factor, e.g. DivisionByLengthNormalization.
+        \param SampleCnt ... The count of samples to deal with.
+        \param Complex ... Complex data type.
+    */
+    template<typename Normalization,
+             typename SampleCnt,
+             typename Complex>
+    class ConjugatedNormalization
+        : public SubTask<ConjugatedNormalization<Normalization, SampleCnt, Complex>,
+                         Complex>
+    {
+    public:
+        /** Conjugates each element of data and scales it by factor().
+            \param[in, out] data ... Pointer to an array of SampleCnt elements of type Complex.
+        */
+        void operator()(Complex* data) const
+        {
+            for (std::size_t i = 0; i < SampleCnt::value; ++i)
+            {
+                data[i] = Complex(data[i].real() * factor(), -data[i].imag() * factor());
+            }
+        }
+
+        /** Returns the factor of Normalization which each element is scaled by.
+        */
+        static constexpr typename Complex::value_type factor(void)
+        {
+            return Normalization::factor();
+        }
+    };
+}
@@ -21,5 +21,12 @@ namespace jeanbaptiste::normalization
         */
         void operator()(Complex*) const
         {}
+
+        /** Returns the factor 1 which each element is (not) scaled by.
+        */
+        static constexpr typename Complex::value_type factor(void)
+        {
+            return 1;
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <boost/hana.hpp>
+#include "ConjugatedNormalization.h"
+#include "DivisionByLengthNormalization.h"
+#include "NoNormalization.h"
+#include "../Options.h"
+#include "SquareRootNormalization.h"
+#include <type_traits>
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::normalization
+{
+    /** Checks whether the normalization option conjugates the data while normalizing it.
+        type is the normalization option without conjugation.
+    */
+    template <typename Normalization>
+    struct IsNormalizationConjugated
+        : std::false_type
+    {
+        using type = Normalization;
+    };
+
+    template <typename Normalization>
+    struct IsNormalizationConjugated<jbo::Normalization_Conjugated<Normalization>>
+        : std::true_type
+    {
+        using type = Normalization;
+    };
+
+    /** Creates a value of the normalization sub task type selected by a normalization option at compilation time.
+        \param Normalization ... The normalization option, e.g. Normalization_Square_Root or
+                                 Normalization_Conjugated<Normalization_Division_By_Length>.
+        \param SampleCnt ... The count of samples to be normalized.
+        \param Complex ... The complex data type.
+        \return value ... The selected value.
+    */
+    template <typename Normalization,
+              typename SampleCnt,
+              typename Complex>
+    constexpr auto selectNormalization(void)
+    {
+        if constexpr (IsNormalizationConjugated<Normalization>::value)
+            return ConjugatedNormalization<
+                decltype(selectNormalization<typename IsNormalizationConjugated<Normalization>::type, SampleCnt, Complex>()),
+                SampleCnt,
+                Complex>{};
+        else
+            return
+                hana::if_(hana::typeid_(Normalization{}) == hana::type<jbo::Normalization_Division_By_Length>{},
+                    DivisionByLengthNormalization<
+                        SampleCnt,
+                        typename decltype(std::integral_constant<int, 0>{})::type,
+                        Complex>{},
+                hana::if_(hana::typeid_(Normalization{}) == hana::type<jbo::Normalization_Square_Root>{},
+                    SquareRootNormalization<
+                        SampleCnt,
+                        typename decltype(std::integral_constant<int, 0>{})::type,
+                        Complex>{},
+                    NoNormalization<
+                        SampleCnt,
+                        Complex>{}
+                ));
+    }
+}
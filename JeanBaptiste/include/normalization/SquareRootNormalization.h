@@ -37,8 +37,15 @@ namespace jeanbaptiste::normalization
         {
             for (std::size_t i = 0; i < SampleCnt::value; ++i)
             {
-                data[i] *= static_cast<typename Complex::value_type>(1 / basic::squareRoot<typename Complex::value_type>(0, 8, getDenominator()));
+                data[i] *= factor();
             }
         }
+
+        /** Returns the factor 1/sqrt(N) which each element is scaled by.
+        */
+        static constexpr typename Complex::value_type factor(void)
+        {
+            return static_cast<typename Complex::value_type>(1 / basic::squareRoot<typename Complex::value_type>(0, 8, getDenominator()));
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <complex>
+#include "ExecuteSpectrumOnComplexData.h"
+#include "../SubTask.h"
+
+namespace jeanbaptiste::postprocessing
+{
+    /** Puts out the level 20 * log10(|X[k]|) in dB of the first FrequencyCnt bins into a separate real buffer.
+        The normalization is folded into the conversion, so the normalization pass is skipped.
+        \param FrequencyCnt ... The count of bins to be converted.
+        \param Normalization ... The normalization sub task of the algorithm.
+        \param Complex ... Complex data type.
+    */
+    template<typename FrequencyCnt,
+             typename Normalization,
+             typename Complex>
+    class DecibelSpectrum
+        : public SubTask<DecibelSpectrum<FrequencyCnt, Normalization, Complex>,
+                         Complex>
+    {
+        using ValueType = typename Complex::value_type;
+
+        Normalization normalization_;
+
+    public:
+        /** Normalizes data the same way Normalization does, if no spectrum is requested.
+            \param[in, out] data ... Pointer to an array of elements of type Complex.
+        */
+        void operator()(Complex* data) const
+        {
+            normalization_(data);
+        }
+
+        /** Calculates the level of the normalized spectrum in dB. Bins of zero magnitude are clamped to a level close to
+            the smallest normal value.
+            \param[in] data ... Pointer to an array of elements of type Complex. Data is not normalized.
+            \param[out] spectrum ... Pointer to an array of FrequencyCnt real values.
+        */
+        void operator()(const Complex* data, ValueType* spectrum) const
+        {
+            ExecuteSpectrumOnComplexData<Complex>::power(data, spectrum, FrequencyCnt::value,
+                Normalization::factor() * Normalization::factor());
+            // 20 * log10(|X[k]|) = 10 * log10(|X[k]|^2) does not need a square root.
+            ExecuteSpectrumOnComplexData<Complex>::decibel(spectrum, FrequencyCnt::value);
+        }
+    };
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "../basic/FastLogarithm.h"
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define JEANBAPTISTE_SPECTRUM_USE_SSE2
+#endif
+
+namespace jeanbaptiste::postprocessing
+{
+    /** Converts complex data into real spectra.
+        std::complex<T> is layout compatible with T[2] which allows processing whole complex values per SIMD register:
+        two std::complex<double> or four std::complex<float> per two 128 bit registers.
+        \param Complex ... The complex data type.
+    */
+    template <typename Complex>
+    class ExecuteSpectrumOnComplexData
+    {
+        using ValueType = typename Complex::value_type;
+
+    public:
+        /** Calculates scale * |data[i]|^2.
+            \param[in] data ... Pointer to an array of count elements of type Complex.
+            \param[out] spectrum ... Pointer to an array of count real values.
+            \param[in] count ... The count of values.
+            \param[in] scale ... The factor applied on each power.
+        */
+        static void power(const Complex* data, ValueType* spectrum, const std::size_t count, const ValueType scale)
+        {
+            std::size_t i = 0;
+
+#if defined(JEANBAPTISTE_SPECTRUM_USE_SSE2)
+            if constexpr (std::is_same_v<Complex, std::complex<double>>)
+            {
+                auto values = reinterpret_cast<const double*>(data);
+                const __m128d factor = _mm_set1_pd(scale);
+                const std::size_t vectorEnd = count & ~std::size_t{1};
+
+                for (; i < vectorEnd; i += 2)
+                {
+                    // (re0^2, im0^2) and (re1^2, im1^2)
+                    const __m128d first = _mm_loadu_pd(values + 2 * i);
+                    const __m128d second = _mm_loadu_pd(values + 2 * i + 2);
+                    const __m128d squares0 = _mm_mul_pd(first, first);
+                    const __m128d squares1 = _mm_mul_pd(second, second);
+
+                    // (re0^2 + im0^2, re1^2 + im1^2)
+                    const __m128d sum = _mm_add_pd(_mm_unpacklo_pd(squares0, squares1), _mm_unpackhi_pd(squares0, squares1));
+                    _mm_storeu_pd(spectrum + i, _mm_mul_pd(sum, factor));
+                }
+            }
+            else if constexpr (std::is_same_v<Complex, std::complex<float>>)
+            {
+                auto values = reinterpret_cast<const float*>(data);
+                const __m128 factor = _mm_set1_ps(scale);
+                const std::size_t vectorEnd = count & ~std::size_t{3};
+
+                for (; i < vectorEnd; i += 4)
+                {
+                    const __m128 first = _mm_loadu_ps(values + 2 * i);
+                    const __m128 second = _mm_loadu_ps(values + 2 * i + 4);
+                    const __m128 squares0 = _mm_mul_ps(first, first);
+                    const __m128 squares1 = _mm_mul_ps(second, second);
+
+                    // (re0^2, re1^2, re2^2, re3^2) + (im0^2, im1^2, im2^2, im3^2)
+                    const __m128 sum = _mm_add_ps(
+                        _mm_shuffle_ps(squares0, squares1, _MM_SHUFFLE(2, 0, 2, 0)),
+                        _mm_shuffle_ps(squares0, squares1, _MM_SHUFFLE(3, 1, 3, 1)));
+                    _mm_storeu_ps(spectrum + i, _mm_mul_ps(sum, factor));
+                }
+            }
+#endif
+
+            for (; i < count; ++i)
+                spectrum[i] = std::norm(data[i]) * scale;
+        }
+
+        /** Replaces each value by its square root.
+            \param[in, out] spectrum ... Pointer to an array of count non negative real values.
+            \param[in] count ... The count of values.
+        */
+        static void squareRoot(ValueType* spectrum, const std::size_t count)
+        {
+            std::size_t i = 0;
+
+#if defined(JEANBAPTISTE_SPECTRUM_USE_SSE2)
+            if constexpr (std::is_same_v<ValueType, double>)
+            {
+                const std::size_t vectorEnd = count & ~std::size_t{1};
+
+                for (; i < vectorEnd; i += 2)
+                    _mm_storeu_pd(spectrum + i, _mm_sqrt_pd(_mm_loadu_pd(spectrum + i)));
+            }
+            else if constexpr (std::is_same_v<ValueType, float>)
+            {
+                const std::size_t vectorEnd = count & ~std::size_t{3};
+
+                for (; i < vectorEnd; i += 4)
+                    _mm_storeu_ps(spectrum + i, _mm_sqrt_ps(_mm_loadu_ps(spectrum + i)));
+            }
+#endif
+
+            for (; i < count; ++i)
+                spectrum[i] = std::sqrt(spectrum[i]);
+        }
+
+        /** Replaces each value by 10 * log10(value) using a branch free approximation.
+            \param[in, out] spectrum ... Pointer to an array of count non negative real values, e.g. powers.
+            \param[in] count ... The count of values.
+        */
+        static void decibel(ValueType* spectrum, const std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                spectrum[i] = basic::fastDecibel(spectrum[i]);
+        }
+    };
+}
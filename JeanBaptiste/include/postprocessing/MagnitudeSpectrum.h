@@ -0,0 +1,46 @@
+#pragma once
+
+#include <complex>
+#include "ExecuteSpectrumOnComplexData.h"
+#include "../SubTask.h"
+
+namespace jeanbaptiste::postprocessing
+{
+    /** Puts out the magnitude spectrum |X[k]| of the first FrequencyCnt bins into a separate real buffer.
+        The normalization is folded into the conversion, so the normalization pass is skipped.
+        \param FrequencyCnt ... The count of bins to be converted.
+        \param Normalization ... The normalization sub task of the algorithm.
+        \param Complex ... Complex data type.
+    */
+    template<typename FrequencyCnt,
+             typename Normalization,
+             typename Complex>
+    class MagnitudeSpectrum
+        : public SubTask<MagnitudeSpectrum<FrequencyCnt, Normalization, Complex>,
+                         Complex>
+    {
+        using ValueType = typename Complex::value_type;
+
+        Normalization normalization_;
+
+    public:
+        /** Normalizes data the same way Normalization does, if no spectrum is requested.
+            \param[in, out] data ... Pointer to an array of elements of type Complex.
+        */
+        void operator()(Complex* data) const
+        {
+            normalization_(data);
+        }
+
+        /** Calculates the normalized magnitude spectrum.
+            \param[in] data ... Pointer to an array of elements of type Complex. Data is not normalized.
+            \param[out] spectrum ... Pointer to an array of FrequencyCnt real values.
+        */
+        void operator()(const Complex* data, ValueType* spectrum) const
+        {
+            ExecuteSpectrumOnComplexData<Complex>::power(data, spectrum, FrequencyCnt::value,
+                Normalization::factor() * Normalization::factor());
+            ExecuteSpectrumOnComplexData<Complex>::squareRoot(spectrum, FrequencyCnt::value);
+        }
+    };
+}
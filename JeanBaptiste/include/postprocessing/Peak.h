@@ -0,0 +1,16 @@
+#pragma once
+
+namespace jeanbaptiste::postprocessing
+{
+    /** Describes a spectral peak.
+        \param ValueType ... The real data type.
+    */
+    template <typename ValueType>
+    struct Peak
+    {
+        // The interpolated position of the peak in bins, e.g. 12.3 lies between bin 12 and 13.
+        ValueType frequency;
+        // The interpolated magnitude of the peak.
+        ValueType amplitude;
+    };
+}
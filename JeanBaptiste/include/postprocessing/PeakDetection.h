@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <limits>
+#include "../Options.h"
+#include "Peak.h"
+#include "../SubTask.h"
+#include <type_traits>
+#include <utility>
+
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::postprocessing
+{
+    /** Finds the PeakCnt strongest local maxima of the magnitude within the first FrequencyCnt bins in a single pass.
+        The bins are walked once while a min heap keeps the strongest peaks found so far. Afterwards each peak is refined:
+        - Interpolation_Parabolic: a parabola is fitted through the log magnitudes of the peak bin and its neighbours.
+        - Interpolation_Jacobsen: the offset is estimated from the complex values: Re((X[k-1] - X[k+1]) / (2X[k] - X[k-1] - X[k+1])).
+        The amplitude is the maximum of the parabola through the log magnitudes at the estimated offset.
+        The normalization is folded into the amplitudes, so the normalization pass is skipped.
+        \param FrequencyCnt ... The count of bins to be searched.
+        \param Normalization ... The normalization sub task of the algorithm.
+        \param Complex ... Complex data type.
+        \param PeakCnt ... The maximum count of peaks to be found.
+        \param Interpolation ... The interpolation option: Interpolation_Parabolic or Interpolation_Jacobsen.
+    */
+    template<typename FrequencyCnt,
+             typename Normalization,
+             typename Complex,
+             std::size_t PeakCnt,
+             typename Interpolation>
+    class PeakDetection
+        : public SubTask<PeakDetection<FrequencyCnt, Normalization, Complex, PeakCnt, Interpolation>,
+                         Complex>
+    {
+        static_assert(PeakCnt > 0, "Trying to find no peaks at all.");
+
+        using ValueType = typename Complex::value_type;
+        // The power and the index of a peak bin.
+        using Candidate = std::pair<ValueType, std::size_t>;
+
+        Normalization normalization_;
+
+        /** Refines the position and magnitude of a peak found in bin index.
+        */
+        static Peak<ValueType> interpolate(const Complex* data, const std::size_t index)
+        {
+            // Log magnitudes. Bins of zero magnitude are clamped to avoid log(0).
+            auto logMagnitude = [&](const std::size_t i)
+            {
+                return std::log(std::max(std::abs(data[i]), std::numeric_limits<ValueType>::min()));
+            };
+            const auto left = logMagnitude(index - 1);
+            const auto center = logMagnitude(index);
+            const auto right = logMagnitude(index + 1);
+
+            ValueType offset(0);
+            if constexpr (std::is_same_v<Interpolation, jbo::Interpolation_Jacobsen>)
+            {
+                const auto denominator = data[index] * ValueType(2) - data[index - 1] - data[index + 1];
+                if (std::norm(denominator) > 0)
+                    offset = ((data[index - 1] - data[index + 1]) / denominator).real();
+            }
+            else
+            {
+                const auto curvature = left - 2 * center + right;
+                if (curvature < 0)
+                    offset = ValueType(0.5) * (left - right) / curvature;
+            }
+
+            // The bin is a local maximum, so the true peak lies within half a bin.
+            offset = std::clamp(offset, ValueType(-0.5), ValueType(0.5));
+
+            return
+            {
+                static_cast<ValueType>(index) + offset,
+                std::exp(center - ValueType(0.25) * (left - right) * offset) * Normalization::factor()
+            };
+        }
+
+    public:
+        /** Normalizes data the same way Normalization does, if no peaks are requested.
+            \param[in, out] data ... Pointer to an array of elements of type Complex.
+        */
+        void operator()(Complex* data) const
+        {
+            normalization_(data);
+        }
+
+        /** Finds the strongest peaks.
+            \param[in] data ... Pointer to an array of at least FrequencyCnt + 1 elements of type Complex. Data is not normalized.
+            \param[out] peaks ... Pointer to an array of PeakCnt peaks, sorted by descending power of their peak bins.
+            \return std::size_t ... The count of peaks found: 0 ... PeakCnt.
+        */
+        std::size_t operator()(const Complex* data, Peak<ValueType>* peaks) const
+        {
+            std::array<Candidate, PeakCnt> heap;
+            std::size_t candidateCnt = 0;
+
+            // Keep the powers of three neighboring bins so that each bin is squared once.
+            auto previous = std::norm(data[0]);
+            auto current = std::norm(data[1]);
+
+            for (std::size_t k = 1; k < FrequencyCnt::value; ++k)
+            {
+                const auto next = std::norm(data[k + 1]);
+
+                if (current > previous && current >= next)
+                {
+                    if (candidateCnt < PeakCnt)
+                    {
+                        heap[candidateCnt++] = {current, k};
+                        std::push_heap(heap.begin(), heap.begin() + candidateCnt, std::greater<Candidate>{});
+                    }
+                    else if (current > heap.front().first)
+                    {
+                        // Replace the weakest peak.
+                        std::pop_heap(heap.begin(), heap.end(), std::greater<Candidate>{});
+                        heap.back() = {current, k};
+                        std::push_heap(heap.begin(), heap.end(), std::greater<Candidate>{});
+                    }
+                }
+
+                previous = current;
+                current = next;
+            }
+
+            // Descending power.
+            std::sort_heap(heap.begin(), heap.begin() + candidateCnt, std::greater<Candidate>{});
+
+            for (std::size_t i = 0; i < candidateCnt; ++i)
+                peaks[i] = interpolate(data, heap[i].second);
+
+            return candidateCnt;
+        }
+    };
+}
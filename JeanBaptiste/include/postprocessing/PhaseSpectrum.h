@@ -0,0 +1,44 @@
+#pragma once
+
+#include <complex>
+#include "../SubTask.h"
+
+namespace jeanbaptiste::postprocessing
+{
+    /** Puts out the phase spectrum arg(X[k]) in [-pi, pi] of the first FrequencyCnt bins into a separate real buffer.
+        Normalization does not change the phase, so the normalization pass is skipped.
+        \param FrequencyCnt ... The count of bins to be converted.
+        \param Normalization ... The normalization sub task of the algorithm.
+        \param Complex ... Complex data type.
+    */
+    template<typename FrequencyCnt,
+             typename Normalization,
+             typename Complex>
+    class PhaseSpectrum
+        : public SubTask<PhaseSpectrum<FrequencyCnt, Normalization, Complex>,
+                         Complex>
+    {
+        using ValueType = typename Complex::value_type;
+
+        Normalization normalization_;
+
+    public:
+        /** Normalizes data the same way Normalization does, if no spectrum is requested.
+            \param[in, out] data ... Pointer to an array of elements of type Complex.
+        */
+        void operator()(Complex* data) const
+        {
+            normalization_(data);
+        }
+
+        /** Calculates the phase spectrum.
+            \param[in] data ... Pointer to an array of elements of type Complex. Data is not normalized.
+            \param[out] spectrum ... Pointer to an array of FrequencyCnt real values.
+        */
+        void operator()(const Complex* data, ValueType* spectrum) const
+        {
+            for (std::size_t i = 0; i < FrequencyCnt::value; ++i)
+                spectrum[i] = std::arg(data[i]);
+        }
+    };
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <boost/hana.hpp>
+#include <complex>
+#include <type_traits>
+#include "DecibelSpectrum.h"
+#include "MagnitudeSpectrum.h"
+#include "../normalization/NormalizationSelection.h"
+#include "../Options.h"
+#include "PeakDetection.h"
+#include "PhaseSpectrum.h"
+#include "PowerSpectrum.h"
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::postprocessing
+{
+    /** Checks whether a spectrum option is Spectrum_Peaks.
+    */
+    template <typename Spectrum>
+    struct IsSpectrumPeaks
+        : std::false_type
+    {};
+
+    template <std::size_t PeakCnt,
+              typename Interpolation>
+    struct IsSpectrumPeaks<jbo::Spectrum_Peaks<PeakCnt, Interpolation>>
+        : std::true_type
+    {};
+
+    /** Creates a value of the peak detection sub task selected by Spectrum_Peaks at compilation time.
+    */
+    template <typename FrequencyCnt,
+              typename Normalization,
+              typename Complex,
+              std::size_t PeakCnt,
+              typename Interpolation>
+    constexpr auto selectPeakDetection(jbo::Spectrum_Peaks<PeakCnt, Interpolation>)
+    {
+        return PeakDetection<FrequencyCnt, Normalization, Complex, PeakCnt, Interpolation>{};
+    }
+
+    /** Creates a value of the last sub task of an algorithm at compilation time: the normalization sub task for Spectrum_Complex
+        or a spectrum sub task which folds the normalization into the conversion into a real spectrum or into peak detection.
+        \param Spectrum ... The spectrum option, e.g. Spectrum_Magnitude or Spectrum_Peaks.
+        \param Normalization ... The normalization option, e.g. Normalization_Square_Root.
+        \param SampleCnt ... The count of samples to be normalized.
+        \param Complex ... The complex data type.
+        \return value ... The selected value.
+    */
+    template <typename Spectrum,
+              typename Normalization,
+              typename SampleCnt,
+              typename Complex>
+    constexpr auto selectSpectrum(void)
+    {
+        using NormalizationType = decltype(normalization::selectNormalization<Normalization, SampleCnt, Complex>());
+        using FrequencyCnt = typename decltype(std::integral_constant<int, (SampleCnt::value >> 1)>{})::type;
+
+        if constexpr (IsSpectrumPeaks<Spectrum>::value)
+            return selectPeakDetection<FrequencyCnt, NormalizationType, Complex>(Spectrum{});
+        else
+            return
+                hana::if_(hana::typeid_(Spectrum{}) == hana::type<jbo::Spectrum_Decibel>{},
+                    DecibelSpectrum<FrequencyCnt, NormalizationType, Complex>{},
+                hana::if_(hana::typeid_(Spectrum{}) == hana::type<jbo::Spectrum_Magnitude>{},
+                    MagnitudeSpectrum<FrequencyCnt, NormalizationType, Complex>{},
+                hana::if_(hana::typeid_(Spectrum{}) == hana::type<jbo::Spectrum_Phase>{},
+                    PhaseSpectrum<FrequencyCnt, NormalizationType, Complex>{},
+                hana::if_(hana::typeid_(Spectrum{}) == hana::type<jbo::Spectrum_Power>{},
+                    PowerSpectrum<FrequencyCnt, NormalizationType, Complex>{},
+                    NormalizationType{}
+                ))));
+    }
+}
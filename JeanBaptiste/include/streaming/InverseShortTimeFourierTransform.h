@@ -0,0 +1,145 @@
+#pragma once
+
+#include "../AlgorithmFactory.h"
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <limits>
+#include <memory>
+#include "../Options.h"
+#include "../tools/SampleConversion.h"
+#include <vector>
+#include "../windowing/ExecuteWindowOnComplexData.h"
+#include "../windowing/WindowSelection.h"
+
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::streaming
+{
+    /** Resynthesizes a continuous stream of samples from a sequence of spectra using weighted overlap-add.
+        Each spectrum is transformed back, multiplied by the synthesis window and added into an output ring buffer of N samples
+        (N = frame length). Every pushed spectrum completes hop size samples which are normalized by the precomputed sum of the
+        squared windows overlapping at their position and handed out. The latency is one frame; no memory is allocated per frame.
+        The spectra are expected to come from a ShortTimeFourierTransform using the same Window and hop size. Normalization has to
+        be chosen so that the backward transform undoes the normalization of the forward transform.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Radix ... The radix of the FFT algorithm.
+        \param Decimation ... The decimation type of the FFT algorithm.
+        \param Window ... The analysis window which is also used as synthesis window.
+        \param Normalization ... The normalization applied by the backward transform.
+        \param Complex ... The complex data type.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Window,
+              typename Normalization,
+              typename Complex>
+    class InverseShortTimeFourierTransform
+    {
+        using ValueType = typename Complex::value_type;
+        using FactoryType = AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Backward, jbo::Window_None,
+            Normalization, Complex>;
+
+        std::unique_ptr<ExecutableAlgorithm<Complex>> algorithm_;
+        std::size_t sampleCnt_;
+        std::size_t hopSize_;
+        std::vector<ValueType> window_;
+        // Reciprocal of the summed squared windows for each position within a hop.
+        std::vector<ValueType> normalization_;
+        // Ring buffer of sampleCnt_ samples the frames are overlap-added into.
+        std::vector<Complex> accumulator_;
+        // Work buffer which the backward FFT is calculated in place on.
+        std::vector<Complex> frame_;
+        // Position of the oldest (next to be completed) sample in the ring buffer.
+        std::size_t readPosition_;
+
+        /** Calculates the reciprocal of sum(w^2[i + m * hopSize]) for each position i within a hop (constant overlap-add condition).
+            Positions where no window contributes any energy are left unscaled.
+        */
+        void createNormalization(void)
+        {
+            for (std::size_t i = 0; i < hopSize_; ++i)
+            {
+                ValueType sum(0);
+                for (auto j = i; j < sampleCnt_; j += hopSize_)
+                    sum += window_[j] * window_[j];
+
+                normalization_[i] = (sum > std::numeric_limits<ValueType>::epsilon()) ? ValueType(1) / sum : ValueType(1);
+            }
+        }
+
+    public:
+        /** Creates the inverse transform.
+            \param[in] stage ... The stage of the FFT algorithm which determines the frame length.
+            \param[in] hopSize ... The count of samples between the start of two consecutive frames: 1 ... frame length.
+        */
+        InverseShortTimeFourierTransform(const std::size_t stage, const std::size_t hopSize)
+            : algorithm_(FactoryType().getAlgorithm(stage)),
+              sampleCnt_(algorithm_->numberOfSamples()),
+              hopSize_(hopSize),
+              window_(windowing::createWindowSamples<Window, Complex>(sampleCnt_)),
+              normalization_(hopSize),
+              accumulator_(sampleCnt_),
+              frame_(sampleCnt_),
+              readPosition_(0)
+        {
+            assert(hopSize_ > 0 && hopSize_ <= sampleCnt_ && "Trying to use a hop size outside of [1, frame length].");
+
+            createNormalization();
+        }
+
+        /** Overlap-adds a spectrum and hands out the hop size samples completed by it.
+            The first frame length - hop size samples of a stream are not fully overlapped yet and ramp up accordingly.
+            \param[in] spectrum ... Pointer to an array of frameLength() elements.
+            \param[out] output ... Pointer to an array of hopSize() elements. Either of type Complex or of its value type (real part).
+        */
+        template <typename Sample>
+        void push(const Complex* spectrum, Sample* output)
+        {
+            static_assert(std::is_same_v<Sample, Complex> || std::is_same_v<Sample, ValueType>,
+                "Trying to output samples of a type other than the complex type or its value type.");
+
+            std::copy_n(spectrum, sampleCnt_, frame_.begin());
+            algorithm_->operator()(&frame_[0]);
+            windowing::ExecuteWindowOnComplexData<Complex, jbo::WindowInput_Complex>{}(&frame_[0], &window_[0], sampleCnt_);
+
+            // Overlap-add the frame into the ring buffer - in two parts if it wraps around.
+            auto firstPart = sampleCnt_ - readPosition_;
+            for (std::size_t i = 0; i < firstPart; ++i)
+                accumulator_[readPosition_ + i] += frame_[i];
+            for (auto i = firstPart; i < sampleCnt_; ++i)
+                accumulator_[i - firstPart] += frame_[i];
+
+            // The oldest hopSize_ samples do not receive any further contributions.
+            for (std::size_t i = 0; i < hopSize_; ++i)
+            {
+                auto& value = accumulator_[readPosition_];
+                tools::storeSample(output + i, value * normalization_[i]);
+                value = Complex{};
+
+                readPosition_ = (readPosition_ + 1 == sampleCnt_) ? 0 : readPosition_ + 1;
+            }
+        }
+
+        /** Drops all partially overlap-added samples.
+        */
+        void reset(void)
+        {
+            std::fill(accumulator_.begin(), accumulator_.end(), Complex{});
+            readPosition_ = 0;
+        }
+
+        std::size_t frameLength(void) const
+        {
+            return sampleCnt_;
+        }
+
+        std::size_t hopSize(void) const
+        {
+            return hopSize_;
+        }
+    };
+}
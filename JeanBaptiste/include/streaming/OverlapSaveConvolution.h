@@ -0,0 +1,177 @@
+#pragma once
+
+#include "../AlgorithmFactory.h"
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <memory>
+#include "../Options.h"
+#include "../tools/SampleConversion.h"
+#include <vector>
+
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::streaming
+{
+    /** Convolves a continuous stream of samples with a FIR filter using the overlap-save method.
+        The FFT length N is selected by stage, the filter length L may be up to N. Every N - L + 1 input samples one forward FFT,
+        one spectral multiplication with the precomputed filter spectrum and one backward FFT are run. The first L - 1 samples
+        of the backward transform are corrupted by circular convolution and discarded.
+        Input can be processed in blocks of arbitrary size. Output is delayed by one block of N - L + 1 samples.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Radix ... The radix of the FFT algorithm.
+        \param Decimation ... The decimation type of the FFT algorithm.
+        \param Complex ... The complex data type.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Complex>
+    class OverlapSaveConvolution
+    {
+        using ValueType = typename Complex::value_type;
+        using ForwardFactoryType = AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_No, Complex>;
+        using BackwardFactoryType = AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Backward, jbo::Window_None,
+            jbo::Normalization_No, Complex>;
+
+        std::unique_ptr<ExecutableAlgorithm<Complex>> forward_;
+        std::unique_ptr<ExecutableAlgorithm<Complex>> backward_;
+        std::size_t sampleCnt_;
+        std::size_t filterLength_;
+        std::size_t blockSize_;
+        // Filter spectrum, already scaled by 1/N so that the backward transform does not need any normalization.
+        std::vector<Complex> filterSpectrum_;
+        // The last L - 1 input samples followed by the input samples of the current block.
+        std::vector<Complex> input_;
+        // Output samples of the previous block.
+        std::vector<Complex> output_;
+        // Work buffer which the FFTs are calculated in place on.
+        std::vector<Complex> frame_;
+        // Count of input samples collected for the current block.
+        std::size_t fillLevel_;
+
+        /** Convolves the collected block and keeps the history of the last L - 1 samples.
+        */
+        void processBlock(void)
+        {
+            std::copy(input_.begin(), input_.end(), frame_.begin());
+            forward_->operator()(&frame_[0]);
+
+            for (std::size_t i = 0; i < sampleCnt_; ++i)
+                frame_[i] *= filterSpectrum_[i];
+
+            backward_->operator()(&frame_[0]);
+
+            // The first L - 1 samples are affected by the circular wrap around.
+            std::copy(frame_.begin() + (filterLength_ - 1), frame_.end(), output_.begin());
+            std::copy(input_.end() - (filterLength_ - 1), input_.end(), input_.begin());
+        }
+
+    public:
+        /** Creates the convolution and calculates the filter spectrum.
+            \param[in] stage ... The stage of the FFT algorithm which determines the FFT length N.
+            \param[in] impulseResponse ... Pointer to an array of filterLength filter coefficients. Either of type Complex or of its
+                                           value type.
+            \param[in] filterLength ... The count of filter coefficients: 1 ... N.
+        */
+        template <typename Coefficient>
+        OverlapSaveConvolution(const std::size_t stage, const Coefficient* impulseResponse, const std::size_t filterLength)
+            : forward_(ForwardFactoryType().getAlgorithm(stage)),
+              backward_(BackwardFactoryType().getAlgorithm(stage)),
+              sampleCnt_(forward_->numberOfSamples()),
+              filterLength_(filterLength),
+              blockSize_(sampleCnt_ - filterLength + 1),
+              filterSpectrum_(sampleCnt_),
+              input_(sampleCnt_),
+              output_(blockSize_),
+              frame_(sampleCnt_),
+              fillLevel_(0)
+        {
+            assert(filterLength_ > 0 && filterLength_ <= sampleCnt_ && "Trying to use a filter length outside of [1, FFT length].");
+
+            setImpulseResponse(impulseResponse);
+        }
+
+        /** Replaces the filter. The filter length remains unchanged.
+            \param[in] impulseResponse ... Pointer to an array of filterLength() filter coefficients.
+        */
+        template <typename Coefficient>
+        void setImpulseResponse(const Coefficient* impulseResponse)
+        {
+            static_assert(std::is_same_v<Coefficient, Complex> || std::is_same_v<Coefficient, ValueType>,
+                "Trying to use coefficients of a type other than the complex type or its value type.");
+
+            tools::loadFrame(impulseResponse, filterLength_, &filterSpectrum_[0], sampleCnt_);
+
+            forward_->operator()(&filterSpectrum_[0]);
+
+            const auto scale = ValueType(1) / static_cast<ValueType>(sampleCnt_);
+            for (auto& value : filterSpectrum_)
+                value *= scale;
+        }
+
+        /** Filters a block of samples.
+            \param[in] input ... Pointer to an array of count input samples. Either of type Complex or of its value type.
+            \param[out] output ... Pointer to an array of count output samples. Either of type Complex or of its value type
+                                   (real part). output[i] is the filter response belonging to the input sample blockSize()
+                                   samples before input[i].
+            \param[in] count ... The count of samples.
+        */
+        template <typename InputSample,
+                  typename OutputSample>
+        void operator()(const InputSample* input, OutputSample* output, std::size_t count)
+        {
+            static_assert(std::is_same_v<InputSample, Complex> || std::is_same_v<InputSample, ValueType>,
+                "Trying to filter samples of a type other than the complex type or its value type.");
+            static_assert(std::is_same_v<OutputSample, Complex> || std::is_same_v<OutputSample, ValueType>,
+                "Trying to output samples of a type other than the complex type or its value type.");
+
+            while (count > 0)
+            {
+                auto chunk = std::min(count, blockSize_ - fillLevel_);
+                auto blockInput = &input_[filterLength_ - 1 + fillLevel_];
+
+                for (std::size_t i = 0; i < chunk; ++i)
+                {
+                    blockInput[i] = tools::loadSample<Complex>(input[i]);
+                    tools::storeSample(output + i, output_[fillLevel_ + i]);
+                }
+
+                input += chunk;
+                output += chunk;
+                count -= chunk;
+                fillLevel_ += chunk;
+
+                if (fillLevel_ == blockSize_)
+                {
+                    processBlock();
+                    fillLevel_ = 0;
+                }
+            }
+        }
+
+        /** Clears the input history and all pending output.
+        */
+        void reset(void)
+        {
+            std::fill(input_.begin(), input_.end(), Complex{});
+            std::fill(output_.begin(), output_.end(), Complex{});
+            fillLevel_ = 0;
+        }
+
+        std::size_t filterLength(void) const
+        {
+            return filterLength_;
+        }
+
+        /** Returns the count of new samples per FFT which is also the delay between input and output.
+        */
+        std::size_t blockSize(void) const
+        {
+            return blockSize_;
+        }
+    };
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "../AlgorithmFactory.h"
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <memory>
+#include "../Options.h"
+#include "../tools/SampleConversion.h"
+#include <vector>
+
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::streaming
+{
+    /** Convolves a continuous stream of samples with a long impulse response using uniformly partitioned convolution.
+        The FFT length N is selected by stage and the block size B is N/2. The impulse response is split into P partitions of B
+        coefficients whose spectra are calculated once. Every B input samples the spectrum of the latest N input samples is
+        put into a frequency domain delay line of P spectra. The output spectrum is the sum of the products of each delayed
+        input spectrum with its partition spectrum. One forward and one backward FFT per block are needed no matter how long
+        the impulse response is, while the latency is only B samples instead of the impulse response length.
+        Input can be processed in blocks of arbitrary size. Output is delayed by B samples.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Radix ... The radix of the FFT algorithm.
+        \param Decimation ... The decimation type of the FFT algorithm.
+        \param Complex ... The complex data type.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Complex>
+    class PartitionedConvolution
+    {
+        using ValueType = typename Complex::value_type;
+        using ForwardFactoryType = AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_No, Complex>;
+        using BackwardFactoryType = AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Backward, jbo::Window_None,
+            jbo::Normalization_No, Complex>;
+
+        std::unique_ptr<ExecutableAlgorithm<Complex>> forward_;
+        std::unique_ptr<ExecutableAlgorithm<Complex>> backward_;
+        std::size_t sampleCnt_;
+        std::size_t blockSize_;
+        std::size_t partitionCnt_;
+        // Spectra of all partitions (partitionCnt_ * sampleCnt_), scaled by 1/N so the backward transform needs no normalization.
+        std::vector<Complex> partitionSpectra_;
+        // Frequency domain delay line: ring of partitionCnt_ input spectra.
+        std::vector<Complex> delayLine_;
+        // Index of the delay line slot holding the latest input spectrum.
+        std::size_t delayLinePosition_;
+        // The previous input block followed by the current input block.
+        std::vector<Complex> input_;
+        // Output samples of the previous block.
+        std::vector<Complex> output_;
+        // Work buffer which the FFTs and the spectral accumulation are calculated in place on.
+        std::vector<Complex> frame_;
+        // Count of input samples collected for the current block.
+        std::size_t fillLevel_;
+
+        /** Transforms the latest N input samples into the delay line, multiply-accumulates all partitions and transforms back.
+        */
+        void processBlock(void)
+        {
+            delayLinePosition_ = (delayLinePosition_ == 0) ? partitionCnt_ - 1 : delayLinePosition_ - 1;
+            auto latestSpectrum = &delayLine_[delayLinePosition_ * sampleCnt_];
+
+            std::copy(input_.begin(), input_.end(), latestSpectrum);
+            forward_->operator()(latestSpectrum);
+
+            // Partition p is multiplied with the input spectrum which is p blocks old.
+            std::fill(frame_.begin(), frame_.end(), Complex{});
+            for (std::size_t partition = 0; partition < partitionCnt_; ++partition)
+            {
+                auto slot = delayLinePosition_ + partition;
+                auto spectrum = &delayLine_[((slot < partitionCnt_) ? slot : slot - partitionCnt_) * sampleCnt_];
+                auto partitionSpectrum = &partitionSpectra_[partition * sampleCnt_];
+
+                for (std::size_t i = 0; i < sampleCnt_; ++i)
+                    frame_[i] += spectrum[i] * partitionSpectrum[i];
+            }
+
+            backward_->operator()(&frame_[0]);
+
+            // The first half is affected by the circular wrap around, the second half is valid.
+            std::copy(frame_.begin() + blockSize_, frame_.end(), output_.begin());
+            std::copy(input_.begin() + blockSize_, input_.end(), input_.begin());
+        }
+
+    public:
+        /** Creates the convolution and calculates the spectra of all partitions.
+            \param[in] stage ... The stage of the FFT algorithm which determines the FFT length N. The block size is N/2.
+            \param[in] impulseResponse ... Pointer to an array of impulseResponseLength coefficients. Either of type Complex or
+                                           of its value type.
+            \param[in] impulseResponseLength ... The count of coefficients.
+        */
+        template <typename Coefficient>
+        PartitionedConvolution(const std::size_t stage, const Coefficient* impulseResponse, const std::size_t impulseResponseLength)
+            : forward_(ForwardFactoryType().getAlgorithm(stage)),
+              backward_(BackwardFactoryType().getAlgorithm(stage)),
+              sampleCnt_(forward_->numberOfSamples()),
+              blockSize_(sampleCnt_ >> 1),
+              partitionCnt_((impulseResponseLength + blockSize_ - 1) / blockSize_),
+              partitionSpectra_(partitionCnt_ * sampleCnt_),
+              delayLine_(partitionCnt_ * sampleCnt_),
+              delayLinePosition_(0),
+              input_(sampleCnt_),
+              output_(blockSize_),
+              frame_(sampleCnt_),
+              fillLevel_(0)
+        {
+            static_assert(std::is_same_v<Coefficient, Complex> || std::is_same_v<Coefficient, ValueType>,
+                "Trying to use coefficients of a type other than the complex type or its value type.");
+            assert(impulseResponseLength > 0 && "Trying to use an empty impulse response.");
+            assert(blockSize_ > 0 && "Trying to use a FFT length below 2.");
+
+            const auto scale = ValueType(1) / static_cast<ValueType>(sampleCnt_);
+
+            for (std::size_t partition = 0; partition < partitionCnt_; ++partition)
+            {
+                // Each partition of B coefficients is zero padded to N.
+                auto spectrum = &partitionSpectra_[partition * sampleCnt_];
+                auto first = partition * blockSize_;
+                auto last = std::min(first + blockSize_, impulseResponseLength);
+
+                tools::loadFrame(impulseResponse + first, last - first, spectrum, sampleCnt_);
+                forward_->operator()(spectrum);
+
+                for (std::size_t i = 0; i < sampleCnt_; ++i)
+                    spectrum[i] *= scale;
+            }
+        }
+
+        /** Filters a block of samples.
+            \param[in] input ... Pointer to an array of count input samples. Either of type Complex or of its value type.
+            \param[out] output ... Pointer to an array of count output samples. Either of type Complex or of its value type
+                                   (real part). output[i] is the filter response belonging to the input sample blockSize()
+                                   samples before input[i].
+            \param[in] count ... The count of samples.
+        */
+        template <typename InputSample,
+                  typename OutputSample>
+        void operator()(const InputSample* input, OutputSample* output, std::size_t count)
+        {
+            static_assert(std::is_same_v<InputSample, Complex> || std::is_same_v<InputSample, ValueType>,
+                "Trying to filter samples of a type other than the complex type or its value type.");
+            static_assert(std::is_same_v<OutputSample, Complex> || std::is_same_v<OutputSample, ValueType>,
+                "Trying to output samples of a type other than the complex type or its value type.");
+
+            while (count > 0)
+            {
+                auto chunk = std::min(count, blockSize_ - fillLevel_);
+                auto blockInput = &input_[blockSize_ + fillLevel_];
+
+                for (std::size_t i = 0; i < chunk; ++i)
+                {
+                    blockInput[i] = tools::loadSample<Complex>(input[i]);
+                    tools::storeSample(output + i, output_[fillLevel_ + i]);
+                }
+
+                input += chunk;
+                output += chunk;
+                count -= chunk;
+                fillLevel_ += chunk;
+
+                if (fillLevel_ == blockSize_)
+                {
+                    processBlock();
+                    fillLevel_ = 0;
+                }
+            }
+        }
+
+        /** Clears the input history, the delay line and all pending output.
+        */
+        void reset(void)
+        {
+            std::fill(delayLine_.begin(), delayLine_.end(), Complex{});
+            std::fill(input_.begin(), input_.end(), Complex{});
+            std::fill(output_.begin(), output_.end(), Complex{});
+            delayLinePosition_ = 0;
+            fillLevel_ = 0;
+        }
+
+        std::size_t partitionCount(void) const
+        {
+            return partitionCnt_;
+        }
+
+        /** Returns the count of new samples per FFT which is also the delay between input and output.
+        */
+        std::size_t blockSize(void) const
+        {
+            return blockSize_;
+        }
+    };
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "../AlgorithmFactory.h"
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <memory>
+#include "../Options.h"
+#include "../tools/SampleConversion.h"
+#include <vector>
+
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::streaming
+{
+    /** Calculates a short time Fourier transform on a continuous stream of samples.
+        Samples can be pushed in blocks of arbitrary size. Every hop size samples a frame of the latest N samples (N = frame length)
+        is windowed, transformed and handed over to a frame handler.
+        The samples are kept in a mirrored ring buffer: each sample is stored twice (at position p and p + N). This way the latest
+        N samples are always available as one contiguous block and a frame is prepared with a single copy - no matter how much
+        consecutive frames overlap.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Radix ... The radix of the FFT algorithm.
+        \param Decimation ... The decimation type of the FFT algorithm.
+        \param Window ... The window applied on each frame.
+        \param Normalization ... The normalization applied on each frame.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Window,
+              typename Normalization,
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
+    class ShortTimeFourierTransform
+    {
+        using ValueType = typename Complex::value_type;
+        using FactoryType = AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Forward, Window, Normalization, Complex,
+            WindowInput>;
+
+        std::unique_ptr<ExecutableAlgorithm<Complex>> algorithm_;
+        std::size_t sampleCnt_;
+        std::size_t hopSize_;
+        // Mirrored ring buffer of 2 * sampleCnt_ samples.
+        std::vector<Complex> ringBuffer_;
+        // Work buffer which the FFT is calculated in place on.
+        std::vector<Complex> frame_;
+        // Position where the next sample is written to.
+        std::size_t writePosition_;
+        // Count of samples pushed, saturated at sampleCnt_.
+        std::size_t fillLevel_;
+        // Count of samples pushed since the last frame has been emitted.
+        std::size_t samplesSinceFrame_;
+        // Count of frames emitted.
+        std::size_t frameIndex_;
+
+        /** Transforms the latest sampleCnt_ samples and hands the result over to handler.
+            \param[in] handler ... The frame handler.
+        */
+        template <typename FrameHandler>
+        void emitFrame(FrameHandler& handler)
+        {
+            // The oldest sample is located at writePosition_, the latest one sampleCnt_ - 1 elements behind.
+            std::copy_n(&ringBuffer_[writePosition_], sampleCnt_, frame_.begin());
+            algorithm_->operator()(&frame_[0]);
+
+            handler(static_cast<const Complex*>(&frame_[0]), frameIndex_++);
+        }
+
+    public:
+        /** Creates the transform.
+            \param[in] stage ... The stage of the FFT algorithm which determines the frame length.
+            \param[in] hopSize ... The count of samples between the start of two consecutive frames: 1 ... frame length.
+        */
+        ShortTimeFourierTransform(const std::size_t stage, const std::size_t hopSize)
+            : algorithm_(FactoryType().getAlgorithm(stage)),
+              sampleCnt_(algorithm_->numberOfSamples()),
+              hopSize_(hopSize),
+              ringBuffer_(sampleCnt_ << 1),
+              frame_(sampleCnt_),
+              writePosition_(0),
+              fillLevel_(0),
+              samplesSinceFrame_(0),
+              frameIndex_(0)
+        {
+            assert(hopSize_ > 0 && hopSize_ <= sampleCnt_ && "Trying to use a hop size outside of [1, frame length].");
+        }
+
+        /** Pushes a block of samples. Every completed frame is transformed and handed over to handler.
+            \param[in] samples ... Pointer to an array of count samples. Either of type Complex or of its value type (real samples).
+            \param[in] count ... The count of samples.
+            \param[in] handler ... Callable with signature void(const Complex* spectrum, std::size_t frameIndex). spectrum points to
+                                   frameLength() elements and is valid until the handler returns.
+            \return std::size_t ... The count of frames emitted.
+        */
+        template <typename Sample,
+                  typename FrameHandler>
+        std::size_t push(const Sample* samples, std::size_t count, FrameHandler&& handler)
+        {
+            static_assert(std::is_same_v<Sample, Complex> || std::is_same_v<Sample, ValueType>,
+                "Trying to push samples of a type other than the complex type or its value type.");
+
+            auto framesEmitted = std::size_t{0};
+
+            while (count > 0)
+            {
+                // Copy as many samples as possible without passing the next frame boundary or the end of the ring.
+                // fillLevel_ only stays below sampleCnt_ until the first frame has been emitted.
+                auto samplesUntilFrame = (fillLevel_ < sampleCnt_)
+                    ? sampleCnt_ - fillLevel_
+                    : hopSize_ - samplesSinceFrame_;
+                auto chunk = std::min({count, samplesUntilFrame, sampleCnt_ - writePosition_});
+
+                for (std::size_t i = 0; i < chunk; ++i)
+                {
+                    auto value = tools::loadSample<Complex>(samples[i]);
+                    ringBuffer_[writePosition_ + i] = value;
+                    ringBuffer_[writePosition_ + i + sampleCnt_] = value;
+                }
+
+                samples += chunk;
+                count -= chunk;
+                writePosition_ = (writePosition_ + chunk == sampleCnt_) ? 0 : writePosition_ + chunk;
+                fillLevel_ = std::min(fillLevel_ + chunk, sampleCnt_);
+                samplesSinceFrame_ += chunk;
+
+                // The first frame is emitted as soon as the ring is filled, all following ones every hopSize_ samples.
+                if ((fillLevel_ == sampleCnt_) && (samplesSinceFrame_ >= hopSize_))
+                {
+                    emitFrame(handler);
+                    samplesSinceFrame_ = 0;
+                    ++framesEmitted;
+                }
+            }
+
+            return framesEmitted;
+        }
+
+        /** Drops all buffered samples. The next frame is emitted after frameLength() samples again.
+        */
+        void reset(void)
+        {
+            std::fill(ringBuffer_.begin(), ringBuffer_.end(), Complex{});
+            writePosition_ = 0;
+            fillLevel_ = 0;
+            samplesSinceFrame_ = 0;
+            frameIndex_ = 0;
+        }
+
+        std::size_t frameLength(void) const
+        {
+            return sampleCnt_;
+        }
+
+        std::size_t hopSize(void) const
+        {
+            return hopSize_;
+        }
+
+        std::size_t numberOfFrequencies(void) const
+        {
+            return algorithm_->numberOfFrequencies();
+        }
+    };
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include "../Options.h"
+#include "ShortTimeFourierTransform.h"
+#include <type_traits>
+#include <vector>
+#include "../windowing/WindowCorrectionFactors.h"
+#include "../windowing/WindowSelection.h"
+
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::streaming
+{
+    /** Estimates the power spectral density of a continuous stream of samples using Welch's method.
+        The stream is split into overlapping segments of N samples (N = frame length) which are windowed and transformed by a
+        ShortTimeFourierTransform. The squared magnitudes of each segment are added to a running sum in a single pass over the
+        spectrum. The estimate is available at any time and is scaled by 1 / (fs * sum(w^2[n])) = powerCorrectionFactor / (fs * N).
+        With WindowInput_Real a one sided density of N/2 + 1 bins is estimated (bins 1 ... N/2 - 1 are doubled), with
+        WindowInput_Complex a two sided density of N bins in the order of the FFT output.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Radix ... The radix of the FFT algorithm.
+        \param Decimation ... The decimation type of the FFT algorithm.
+        \param Window ... The window applied on each segment.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the input is real (one sided density) or complex (two sided density).
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Window,
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
+    class WelchPowerSpectralDensity
+    {
+        using ValueType = typename Complex::value_type;
+
+        static constexpr bool kOneSided_ = std::is_same_v<WindowInput, jbo::WindowInput_Real>;
+
+        ShortTimeFourierTransform<Begin, End, Radix, Decimation, Window, jbo::Normalization_No, Complex, WindowInput> transform_;
+        std::size_t binCnt_;
+        // Sum of the squared magnitudes of all segments.
+        std::vector<ValueType> accumulator_;
+        std::size_t segmentCnt_;
+        ValueType scale_;
+
+    public:
+        /** Creates the estimator.
+            \param[in] stage ... The stage of the FFT algorithm which determines the segment length.
+            \param[in] hopSize ... The count of samples between the start of two consecutive segments: 1 ... segment length.
+                                   Half the segment length is a common choice.
+            \param[in] samplingRate ... The sampling rate fs of the input samples.
+        */
+        WelchPowerSpectralDensity(const std::size_t stage, const std::size_t hopSize, const ValueType samplingRate = 1)
+            : transform_(stage, hopSize),
+              binCnt_(kOneSided_ ? (transform_.frameLength() >> 1) + 1 : transform_.frameLength()),
+              accumulator_(binCnt_),
+              segmentCnt_(0),
+              // The window covers all samples of a segment, i.e. 4^stage ones of a radix 4 algorithm.
+              scale_(windowing::calculatePowerCorrectionFactor(windowing::createWindowSamples<Window, Complex>(
+                  transform_.frameLength())) / (samplingRate * static_cast<ValueType>(transform_.frameLength())))
+        {}
+
+        /** Pushes a block of samples. Each completed segment is added to the estimate.
+            \param[in] samples ... Pointer to an array of count samples. Either of type Complex or of its value type (real samples).
+            \param[in] count ... The count of samples.
+            \return std::size_t ... The count of segments completed.
+        */
+        template <typename Sample>
+        std::size_t push(const Sample* samples, const std::size_t count)
+        {
+            return transform_.push(samples, count, [this](const Complex* spectrum, const std::size_t)
+            {
+                for (std::size_t i = 0; i < binCnt_; ++i)
+                    accumulator_[i] += std::norm(spectrum[i]);
+
+                ++segmentCnt_;
+            });
+        }
+
+        /** Writes the averaged power spectral density of all segments since construction or the last reset.
+            \param[out] density ... Pointer to an array of numberOfBins() elements.
+        */
+        void getPowerSpectralDensity(ValueType* density) const
+        {
+            const auto scale = (segmentCnt_ > 0) ? scale_ / static_cast<ValueType>(segmentCnt_) : ValueType(0);
+
+            std::transform(accumulator_.begin(), accumulator_.end(), density, [scale](const ValueType value)
+            {
+                return value * scale;
+            });
+
+            // The energy of negative frequencies is folded into the positive ones. DC and Nyquist exist once.
+            if constexpr (kOneSided_)
+                std::transform(density + 1, density + binCnt_ - 1, density + 1, [](const ValueType value)
+                {
+                    return value * 2;
+                });
+        }
+
+        /** Drops all buffered samples and the current estimate.
+        */
+        void reset(void)
+        {
+            transform_.reset();
+            std::fill(accumulator_.begin(), accumulator_.end(), ValueType(0));
+            segmentCnt_ = 0;
+        }
+
+        std::size_t numberOfBins(void) const
+        {
+            return binCnt_;
+        }
+
+        std::size_t segmentCount(void) const
+        {
+            return segmentCnt_;
+        }
+    };
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "../basic/HalfPrecision.h"
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#define JEANBAPTISTE_HALF_USE_F16C
+#endif
+
+namespace jeanbaptiste::tools
+{
+    /** Converts blocks of complex numbers between 16 bit storage and float.
+        Float16 uses the F16C instructions for four complex numbers at once if they are available (e.g. -mf16c).
+        \param Half ... The storage type: basic::Float16 or basic::BFloat16.
+    */
+    template <typename Half>
+    class HalfPrecisionConversion
+    {
+    public:
+        /** Converts count complex numbers from 16 bit storage into float.
+            \param[in] input ... Pointer to an array of count 16 bit complex numbers.
+            \param[out] output ... Pointer to an array of count complex floats.
+            \param[in] count ... The count of complex numbers.
+        */
+        static void load(const basic::HalfComplex<Half>* input, std::complex<float>* output, const std::size_t count)
+        {
+            std::size_t i = 0;
+
+#if defined(JEANBAPTISTE_HALF_USE_F16C)
+            if constexpr (std::is_same_v<Half, basic::Float16>)
+            {
+                auto halves = reinterpret_cast<const __m128i*>(input);
+                auto values = reinterpret_cast<float*>(output);
+                const std::size_t vectorEnd = count & ~std::size_t{3};
+
+                for (; i < vectorEnd; i += 4)
+                    _mm256_storeu_ps(values + 2 * i, _mm256_cvtph_ps(_mm_loadu_si128(halves + (i >> 2))));
+            }
+#endif
+
+            for (; i < count; ++i)
+                output[i] = input[i];
+        }
+
+        /** Converts count complex floats into 16 bit storage rounding to nearest even.
+            \param[in] input ... Pointer to an array of count complex floats.
+            \param[out] output ... Pointer to an array of count 16 bit complex numbers.
+            \param[in] count ... The count of complex numbers.
+        */
+        static void store(const std::complex<float>* input, basic::HalfComplex<Half>* output, const std::size_t count)
+        {
+            std::size_t i = 0;
+
+#if defined(JEANBAPTISTE_HALF_USE_F16C)
+            if constexpr (std::is_same_v<Half, basic::Float16>)
+            {
+                auto values = reinterpret_cast<const float*>(input);
+                auto halves = reinterpret_cast<__m128i*>(output);
+                const std::size_t vectorEnd = count & ~std::size_t{3};
+
+                for (; i < vectorEnd; i += 4)
+                    _mm_storeu_si128(halves + (i >> 2), _mm256_cvtps_ph(_mm256_loadu_ps(values + 2 * i), _MM_FROUND_TO_NEAREST_INT));
+            }
+#endif
+
+            for (; i < count; ++i)
+                output[i] = input[i];
+        }
+    };
+}
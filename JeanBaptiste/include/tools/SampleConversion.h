@@ -0,0 +1,55 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace jeanbaptiste::tools
+{
+    /** Loads a sample of the complex data type unchanged.
+    */
+    template <typename Complex>
+    Complex loadSample(const Complex& value)
+    {
+        return value;
+    }
+
+    /** Loads a real sample into the real part of the complex data type. The imaginary part is zero.
+    */
+    template <typename Complex>
+    Complex loadSample(const typename Complex::value_type& value)
+    {
+        return Complex(value, 0);
+    }
+
+    /** Stores a sample of the complex data type unchanged.
+    */
+    template <typename Complex>
+    void storeSample(Complex* output, const Complex& value)
+    {
+        *output = value;
+    }
+
+    /** Stores the real part of a sample of the complex data type.
+    */
+    template <typename Complex>
+    void storeSample(typename Complex::value_type* output, const Complex& value)
+    {
+        *output = value.real();
+    }
+
+    /** Loads samples into the beginning of a frame and zero pads the rest of the frame.
+        \param[in] input ... Pointer to an array of count samples. Either of type Complex or of its value type.
+        \param[in] count ... The count of samples: 0 ... frameLength.
+        \param[out] frame ... Pointer to an array of frameLength elements.
+        \param[in] frameLength ... The count of elements of the frame.
+    */
+    template <typename Sample,
+              typename Complex>
+    void loadFrame(const Sample* input, const std::size_t count, Complex* frame, const std::size_t frameLength)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            frame[i] = loadSample<Complex>(input[i]);
+
+        std::fill(frame + count, frame + frameLength, Complex{});
+    }
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "../AlgorithmFactory.h"
+#include <algorithm>
+#include <boost/math/constants/constants.hpp>
+#include <cassert>
+#include <complex>
+#include <memory>
+#include "../Options.h"
+#include <stdexcept>
+#include "../tools/SampleConversion.h"
+#include <type_traits>
+#include <vector>
+
+namespace constants = boost::math::constants;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::transforms
+{
+    /** Evaluates the spectrum of N samples at M equally spaced frequencies of an arbitrary band [f0, f1] (zoom FFT) using the
+        chirp-z transform (Bluestein's algorithm):
+        X[m] = sum(x[n] * e^(j * D * 2 * pi * (f0 + m * df) * n / fs)) with df = (f1 - f0) / (M - 1) and D = 1 (forward) or
+        D = -1 (backward), the same as the FFT algorithms of the same direction.
+        Writing n * m = (n^2 + m^2 - (m - n)^2) / 2 turns the sum into a convolution with a chirp which is calculated by FFTs of
+        length L >= N + M - 1. The chirp tables and the spectrum of the convolution chirp are calculated once per plan,
+        so each transform runs one forward and one backward FFT.
+        \param Begin ... The starting index of supported FFT algorithm stages.
+        \param End ... The end index of supported FFT algorithm stages.
+        \param Radix ... The radix of the FFT algorithm.
+        \param Decimation ... The decimation type of the FFT algorithm.
+        \param Direction ... The sign of the exponent, the same as for FFT algorithms.
+        \param Complex ... The complex data type.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Decimation,
+              typename Direction,
+              typename Complex>
+    class ChirpZTransform
+    {
+        using ValueType = typename Complex::value_type;
+        using ForwardFactoryType = AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Forward, jbo::Window_None,
+            jbo::Normalization_No, Complex>;
+        using BackwardFactoryType = AlgorithmFactory<Begin, End, Radix, Decimation, jbo::Direction_Backward, jbo::Window_None,
+            jbo::Normalization_No, Complex>;
+
+        static constexpr double kDirectionFactor_ = std::is_same_v<Direction, jbo::Direction_Forward> ? 1.0 : -1.0;
+
+        std::unique_ptr<ExecutableAlgorithm<Complex>> forward_;
+        std::unique_ptr<ExecutableAlgorithm<Complex>> backward_;
+        std::size_t sampleCnt_;
+        std::size_t binCnt_;
+        std::size_t transformLength_;
+        double startFrequency_;
+        double frequencyStep_;
+        // e^(j * D * (theta0 * n + phi * n^2 / 2)) applied on the input samples.
+        std::vector<Complex> inputChirp_;
+        // Spectrum of the convolution chirp e^(-j * D * phi * k^2 / 2), already scaled by 1/L.
+        std::vector<Complex> chirpSpectrum_;
+        // e^(j * D * phi * m^2 / 2) applied on the output bins.
+        std::vector<Complex> outputChirp_;
+        // Work buffer which the FFTs are calculated in place on.
+        std::vector<Complex> frame_;
+
+        /** Creates the FFT algorithms of the smallest stage covering at least minimumLength samples.
+            \exception std::length_error ... No stage of [Begin, End) covers minimumLength samples.
+        */
+        void createAlgorithms(const std::size_t minimumLength)
+        {
+            ForwardFactoryType forwardFactory;
+            BackwardFactoryType backwardFactory;
+
+            for (auto stage = Begin; stage < End; ++stage)
+            {
+                forward_ = forwardFactory.getAlgorithm(stage);
+                if (forward_->numberOfSamples() >= minimumLength)
+                {
+                    backward_ = backwardFactory.getAlgorithm(stage);
+                    return;
+                }
+            }
+
+            throw std::length_error("Trying to calculate a chirp-z transform exceeding the largest supported FFT length.");
+        }
+
+        /** Returns e^(j * D * phase).
+        */
+        static Complex rotation(const double phase)
+        {
+            return Complex(static_cast<ValueType>(std::cos(phase)), static_cast<ValueType>(kDirectionFactor_ * std::sin(phase)));
+        }
+
+    public:
+        /** Creates the plan and calculates the chirp tables.
+            \param[in] sampleCnt ... The count of input samples N.
+            \param[in] binCnt ... The count of output bins M.
+            \param[in] startFrequency ... The frequency f0 of the first bin.
+            \param[in] stopFrequency ... The frequency f1 of the last bin.
+            \param[in] samplingRate ... The sampling rate fs of the input samples.
+            \exception std::length_error ... N + M - 1 exceeds the FFT length of the largest stage.
+        */
+        ChirpZTransform(const std::size_t sampleCnt,
+                        const std::size_t binCnt,
+                        const double startFrequency,
+                        const double stopFrequency,
+                        const double samplingRate = 1)
+            : sampleCnt_(sampleCnt),
+              binCnt_(binCnt),
+              transformLength_(0),
+              startFrequency_(startFrequency),
+              frequencyStep_(binCnt > 1 ? (stopFrequency - startFrequency) / (binCnt - 1) : 0),
+              inputChirp_(sampleCnt),
+              outputChirp_(binCnt)
+        {
+            assert(sampleCnt_ > 0 && binCnt_ > 0 && "Trying to create a chirp-z transform of no samples or no bins.");
+
+            createAlgorithms(sampleCnt_ + binCnt_ - 1);
+            transformLength_ = forward_->numberOfSamples();
+            chirpSpectrum_.resize(transformLength_);
+            frame_.resize(transformLength_);
+
+            const auto theta = constants::two_pi<double>() * startFrequency_ / samplingRate;
+            const auto phi = constants::two_pi<double>() * frequencyStep_ / samplingRate;
+
+            for (std::size_t n = 0; n < sampleCnt_; ++n)
+                inputChirp_[n] = rotation(theta * n + 0.5 * phi * n * n);
+
+            for (std::size_t m = 0; m < binCnt_; ++m)
+                outputChirp_[m] = rotation(0.5 * phi * m * m);
+
+            // The convolution chirp covers the lags -(N - 1) ... M - 1, negative lags are wrapped around.
+            for (std::size_t k = 0; k < binCnt_; ++k)
+                chirpSpectrum_[k] = rotation(-0.5 * phi * k * k);
+            for (std::size_t k = 1; k < sampleCnt_; ++k)
+                chirpSpectrum_[transformLength_ - k] = rotation(-0.5 * phi * k * k);
+
+            forward_->operator()(&chirpSpectrum_[0]);
+
+            const auto scale = ValueType(1) / static_cast<ValueType>(transformLength_);
+            for (auto& value : chirpSpectrum_)
+                value *= scale;
+        }
+
+        /** Calculates the bins.
+            \param[in] input ... Pointer to an array of sampleCount() samples. Either of type Complex or of its value type.
+            \param[out] output ... Pointer to an array of binCount() bins.
+        */
+        template <typename Sample>
+        void operator()(const Sample* input, Complex* output)
+        {
+            static_assert(std::is_same_v<Sample, Complex> || std::is_same_v<Sample, ValueType>,
+                "Trying to transform samples of a type other than the complex type or its value type.");
+
+            tools::loadFrame(input, sampleCnt_, &frame_[0], transformLength_);
+            for (std::size_t n = 0; n < sampleCnt_; ++n)
+                frame_[n] *= inputChirp_[n];
+
+            forward_->operator()(&frame_[0]);
+
+            for (std::size_t i = 0; i < transformLength_; ++i)
+                frame_[i] *= chirpSpectrum_[i];
+
+            backward_->operator()(&frame_[0]);
+
+            for (std::size_t m = 0; m < binCnt_; ++m)
+                output[m] = frame_[m] * outputChirp_[m];
+        }
+
+        /** Returns the frequency of a bin.
+            \param[in] bin ... The index of the bin: 0 ... binCount() - 1.
+        */
+        double frequency(const std::size_t bin) const
+        {
+            return startFrequency_ + bin * frequencyStep_;
+        }
+
+        std::size_t sampleCount(void) const
+        {
+            return sampleCnt_;
+        }
+
+        std::size_t binCount(void) const
+        {
+            return binCnt_;
+        }
+
+        /** Returns the length L of the FFTs used for the convolution.
+        */
+        std::size_t transformLength(void) const
+        {
+            return transformLength_;
+        }
+    };
+}
@@ -0,0 +1,295 @@
+#pragma once
+
+#include "../Algorithm.h"
+#include <array>
+#include "../basic/SineCosine.h"
+#include <boost/hana.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <cassert>
+#include <complex>
+#include <memory>
+#include "../Options.h"
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace constants = boost::math::constants;
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::transforms
+{
+    /** Defines a unique interface for dynamic discrete cosine transforms.
+        \param Complex ... Complex data type.
+    */
+    template <typename Complex = std::complex<double>>
+    class ExecutableDiscreteCosineTransform
+    {
+        using ValueType = typename Complex::value_type;
+
+    public:
+        virtual ~ExecutableDiscreteCosineTransform()
+        {}
+
+        virtual void operator()(const ValueType* input, ValueType* output) = 0;
+
+        virtual std::size_t numberOfSamples(void) const = 0;
+    };
+
+    /** Calculates a discrete cosine transform of N real samples using a complex FFT of N/2 samples with pre and post twiddles.
+        The twiddle factors are created at compilation time. No normalization is applied:
+        - Dct_II:  X[k] = sum(x[n] * cos(pi * k * (2n + 1) / (2N)))
+        - Dct_III: X[k] = x[0] / 2 + sum(x[n] * cos(pi * n * (2k + 1) / (2N)), n = 1 ... N - 1), the inverse of Dct_II scaled by N/2
+        - Dct_IV:  X[k] = sum(x[n] * cos(pi * (2n + 1) * (2k + 1) / (4N))), its own inverse scaled by N/2
+        \param Type ... The type of the transform: Dct_II, Dct_III or Dct_IV.
+        \param Stage ... The count of samples N = 2^Stage.
+        \param Radix ... The radix of the FFT algorithm: Radix_2 or Radix_Split_2_4.
+        \param Decimation ... The decimation type of the FFT algorithm.
+        \param Complex ... The complex data type.
+    */
+    template <typename Type,
+              typename Stage,
+              typename Radix,
+              typename Decimation,
+              typename Complex>
+    class DiscreteCosineTransform
+        : public ExecutableDiscreteCosineTransform<Complex>
+    {
+        static_assert(Stage::value >= 2, "Trying to create a discrete cosine transform of less than 4 samples.");
+        static_assert(!std::is_same_v<Radix, jbo::Radix_4>, "Trying to create a discrete cosine transform using a radix 4 FFT.");
+
+        using ValueType = typename Complex::value_type;
+
+        static constexpr std::size_t kSampleCnt_ = std::size_t{1} << Stage::value;
+        static constexpr std::size_t kHalfSampleCnt_ = kSampleCnt_ >> 1;
+
+        /** Returns e^(-j * pi * numerator / denominator).
+        */
+        static constexpr Complex createTwiddle(const double numerator, const double denominator)
+        {
+            return Complex(
+                static_cast<ValueType>(basic::cosine<double>(constants::pi<double>() * numerator / denominator)),
+                static_cast<ValueType>(-basic::sine<double>(constants::pi<double>() * numerator / denominator)));
+        }
+
+        template <std::size_t... Indices>
+        static constexpr auto createSplitTwiddles(std::index_sequence<Indices...>)
+        {
+            return std::array<Complex, sizeof...(Indices)>{createTwiddle(2.0 * Indices, kSampleCnt_)...};
+        }
+
+        template <std::size_t... Indices>
+        static constexpr auto createShiftTwiddles(std::index_sequence<Indices...>)
+        {
+            return std::array<Complex, sizeof...(Indices)>{createTwiddle(0.5 * Indices, kSampleCnt_)...};
+        }
+
+        template <std::size_t... Indices>
+        static constexpr auto createPreTwiddles(std::index_sequence<Indices...>)
+        {
+            return std::array<Complex, sizeof...(Indices)>{createTwiddle(4.0 * Indices + 1.0, 4.0 * kSampleCnt_)...};
+        }
+
+        template <std::size_t... Indices>
+        static constexpr auto createPostTwiddles(std::index_sequence<Indices...>)
+        {
+            return std::array<Complex, sizeof...(Indices)>{createTwiddle(Indices, kSampleCnt_)...};
+        }
+
+        /** Creates the twiddle tables of the selected type at compilation time.
+            Dct_II and Dct_III: e^(-j * 2pi * k / N) which splits the spectrum of N real samples from the spectrum of N/2 complex
+                                samples and e^(-j * pi * k / (2N)) which shifts it by half a sample, k = 0 ... N/2.
+            Dct_IV: e^(-j * pi * (4n + 1) / (4N)) applied before and e^(-j * pi * k / N) applied after the FFT, n, k < N/2.
+        */
+        static constexpr auto createTwiddles(void)
+        {
+            if constexpr (std::is_same_v<Type, jbo::Dct_IV>)
+                return std::make_pair(
+                    createPreTwiddles(std::make_index_sequence<kHalfSampleCnt_>{}),
+                    createPostTwiddles(std::make_index_sequence<kHalfSampleCnt_>{}));
+            else
+                return std::make_pair(
+                    createSplitTwiddles(std::make_index_sequence<kHalfSampleCnt_ + 1>{}),
+                    createShiftTwiddles(std::make_index_sequence<kHalfSampleCnt_ + 1>{}));
+        }
+
+        static constexpr auto kTwiddles_ = createTwiddles();
+
+        // Dct_III transforms into the opposite direction of Dct_II and Dct_IV.
+        using Direction = std::conditional_t<std::is_same_v<Type, jbo::Dct_III>, jbo::Direction_Forward, jbo::Direction_Backward>;
+
+        Algorithm<std::integral_constant<int, Stage::value - 1>, Radix, Decimation, Direction, jbo::Window_None,
+            jbo::Normalization_No, Complex> algorithm_;
+        // Work buffer of N/2 complex samples which the FFT is calculated in place on.
+        std::vector<Complex> frame_;
+
+        /** Dct_II: reorders the samples into v = (x[0], x[2], ..., x[3], x[1]) and packs pairs of v into complex samples.
+            The real spectrum V of v is split from the complex spectrum Z and shifted: X[k] = Re(e^(-j * pi * k / (2N)) * V[k]).
+        */
+        void transformII(const ValueType* input, ValueType* output)
+        {
+            const auto& split = kTwiddles_.first;
+            const auto& shift = kTwiddles_.second;
+
+            // v[n] = x[2n], v[N - 1 - n] = x[2n + 1] and z[n] = v[2n] + j * v[2n + 1].
+            auto reordered = [&](const std::size_t n)
+            {
+                return (n < kHalfSampleCnt_) ? input[n << 1] : input[((kSampleCnt_ - 1 - n) << 1) + 1];
+            };
+            for (std::size_t n = 0; n < kHalfSampleCnt_; ++n)
+                frame_[n] = Complex(reordered(n << 1), reordered((n << 1) + 1));
+
+            algorithm_(&frame_[0]);
+
+            for (std::size_t k = 0; k <= kHalfSampleCnt_; ++k)
+            {
+                const auto z = frame_[k % kHalfSampleCnt_];
+                const auto zMirrored = std::conj(frame_[(kHalfSampleCnt_ - k) % kHalfSampleCnt_]);
+
+                // V[k] = (Z[k] + Z*[N/2 - k]) / 2 - j * e^(-j * 2pi * k / N) * (Z[k] - Z*[N/2 - k]) / 2
+                const auto even = (z + zMirrored) * ValueType(0.5);
+                const auto odd = (z - zMirrored) * Complex(0, -0.5);
+                const auto shifted = shift[k] * (even + split[k] * odd);
+
+                // X[N - k] = -Im(e^(-j * pi * k / (2N)) * V[k]) since V is conjugate symmetric.
+                output[k] = shifted.real();
+                if (k > 0 && k < kHalfSampleCnt_)
+                    output[kSampleCnt_ - k] = -shifted.imag();
+            }
+        }
+
+        /** Dct_III: reverses the steps of Dct_II. V[k] = e^(j * pi * k / (2N)) * (X[k] - j * X[N - k]) is packed into the complex
+            spectrum Z of N/2 samples whose backward transform contains v.
+        */
+        void transformIII(const ValueType* input, ValueType* output)
+        {
+            const auto& split = kTwiddles_.first;
+            const auto& shift = kTwiddles_.second;
+
+            auto spectrum = [&](const std::size_t k)
+            {
+                return std::conj(shift[k]) * Complex(input[k], (k > 0) ? -input[kSampleCnt_ - k] : ValueType(0));
+            };
+
+            for (std::size_t k = 0; k < kHalfSampleCnt_; ++k)
+            {
+                // V[k + N/2] = V*[N/2 - k]
+                const auto v = spectrum(k);
+                const auto vUpper = std::conj(spectrum(kHalfSampleCnt_ - k));
+
+                // Z[k] = (V[k] + V[k + N/2]) / 2 + j * e^(j * 2pi * k / N) * (V[k] - V[k + N/2]) / 2
+                frame_[k] = (v + vUpper) * ValueType(0.5) + Complex(0, 0.5) * std::conj(split[k]) * (v - vUpper);
+            }
+
+            algorithm_(&frame_[0]);
+
+            // x[2n] = v[n], x[2n + 1] = v[N - 1 - n] with v[2n] = Re(z[n]) and v[2n + 1] = Im(z[n]).
+            auto reordered = [&](const std::size_t n) -> ValueType&
+            {
+                return (n < kHalfSampleCnt_) ? output[n << 1] : output[((kSampleCnt_ - 1 - n) << 1) + 1];
+            };
+            for (std::size_t n = 0; n < kHalfSampleCnt_; ++n)
+            {
+                reordered(n << 1) = frame_[n].real();
+                reordered((n << 1) + 1) = frame_[n].imag();
+            }
+        }
+
+        /** Dct_IV: packs x[2n] + j * x[N - 1 - 2n] into N/2 complex samples which are twiddled, transformed and twiddled again.
+            X[2k] = Re(Y[k]) and X[N - 1 - 2k] = -Im(Y[k]).
+        */
+        void transformIV(const ValueType* input, ValueType* output)
+        {
+            const auto& pre = kTwiddles_.first;
+            const auto& post = kTwiddles_.second;
+
+            for (std::size_t n = 0; n < kHalfSampleCnt_; ++n)
+                frame_[n] = pre[n] * Complex(input[n << 1], input[kSampleCnt_ - 1 - (n << 1)]);
+
+            algorithm_(&frame_[0]);
+
+            for (std::size_t k = 0; k < kHalfSampleCnt_; ++k)
+            {
+                const auto y = post[k] * frame_[k];
+                output[k << 1] = y.real();
+                output[kSampleCnt_ - 1 - (k << 1)] = -y.imag();
+            }
+        }
+
+    public:
+        DiscreteCosineTransform(void)
+            : frame_(kHalfSampleCnt_)
+        {}
+
+        /** Calculates the transform. Input and output may be the same array.
+            \param[in] input ... Pointer to an array of N samples.
+            \param[out] output ... Pointer to an array of N coefficients.
+        */
+        void operator()(const ValueType* input, ValueType* output) override
+        {
+            if constexpr (std::is_same_v<Type, jbo::Dct_II>)
+                transformII(input, output);
+            else if constexpr (std::is_same_v<Type, jbo::Dct_III>)
+                transformIII(input, output);
+            else
+                transformIV(input, output);
+        }
+
+        std::size_t numberOfSamples(void) const override
+        {
+            return kSampleCnt_;
+        }
+    };
+
+    /** A factory for discrete cosine transforms of different stage. Each stage is used for a certain count of data samples.
+        \param Begin ... The starting index of supported stages, at least 2.
+        \param End ... The end index of supported stages.
+        \param Type ... The type of the transform: Dct_II, Dct_III or Dct_IV.
+        \param Complex ... The complex data type.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Type,
+              typename Radix,
+              typename Decimation,
+              typename Complex>
+    class DiscreteCosineTransformFactory
+    {
+        using Creator = std::unique_ptr<ExecutableDiscreteCosineTransform<Complex>> (*)(void);
+
+        template <typename TransformType>
+        static std::unique_ptr<ExecutableDiscreteCosineTransform<Complex>> createTransform(void)
+        {
+            return std::make_unique<TransformType>();
+        }
+
+        /** Creates a table of transform creation functions indexed by stage - Begin at compilation time.
+            \return std::array ... The creation function of each stage.
+        */
+        static constexpr auto createCreatorTable(void)
+        {
+            return hana::unpack(hana::make_range(hana::int_c<Begin>, hana::int_c<End>), [](auto... stage)
+            {
+                return std::array<Creator, sizeof...(stage)>
+                {
+                    &createTransform<DiscreteCosineTransform<Type, std::integral_constant<int, decltype(stage)::value>, Radix,
+                        Decimation, Complex>>...
+                };
+            });
+        }
+
+        static constexpr auto creatorTable_ = createCreatorTable();
+
+    public:
+        /** Creates a pointer to a transform instantiation.
+            \param[in] stage ... The stage of the transform which is to be returned. The transform handles 2^stage samples.
+            \return std::unique_ptr ... Pointer to the transform instantiation.
+        */
+        std::unique_ptr<ExecutableDiscreteCosineTransform<Complex>> getTransform(const std::size_t stage) const
+        {
+            assert(stage >= Begin && stage < End && "Trying to find transform of unknown stage.");
+
+            return creatorTable_[stage - Begin]();
+        }
+    };
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <array>
+#include <boost/hana.hpp>
+#include <cassert>
+#include <complex>
+#include "../core/Radix2.h"
+#include "../core/Radix4.h"
+#include "../core/RadixSplit24.h"
+#include "../ExecutableAlgorithm.h"
+#include <memory>
+#include "../Options.h"
+#include "../SubTask.h"
+#include "../tools/SampleConversion.h"
+#include <type_traits>
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::transforms
+{
+    /** Turns the spectrum of a real signal into the spectrum of its analytic signal and normalizes it:
+        DC and Nyquist are scaled by 1/N, positive frequencies by 2/N and negative frequencies are zeroed.
+        The spectrum is expected in bit reversed order, as a DIF FFT puts it out. Frequency k < N/2 lies at an even index then,
+        frequency k >= N/2 at an odd one. DC lies at index 0 and Nyquist at index 1.
+        \param SampleCnt ... The count of samples.
+        \param Complex ... The complex data type.
+    */
+    template <typename SampleCnt,
+              typename Complex>
+    class AnalyticSignalMask
+        : public SubTask<AnalyticSignalMask<SampleCnt, Complex>,
+                         Complex>
+    {
+        using ValueType = typename Complex::value_type;
+
+        static constexpr ValueType kEdgeFactor_ = ValueType(1) / SampleCnt::value;
+        static constexpr ValueType kPositiveFactor_ = ValueType(2) / SampleCnt::value;
+
+    public:
+        void operator()(Complex* data) const
+        {
+            data[0] *= kEdgeFactor_;
+            data[1] *= kEdgeFactor_;
+
+            for (std::size_t i = 2; i < SampleCnt::value; i += 2)
+            {
+                data[i] *= kPositiveFactor_;
+                data[i + 1] = Complex{};
+            }
+        }
+    };
+
+    /** Calculates the analytic signal x[n] + j * H{x}[n] of N real samples x[n] where H is the Hilbert transform.
+        The sub tasks run as a single pipeline in place: a DIF FFT (e^(-j...)) puts out the spectrum in bit reversed order,
+        the analytic signal mask works on that order directly and a DIT FFT (e^(+j...)) takes it back into natural order.
+        No bit reversal and no normalization pass is needed. The envelope of x is the magnitude of the analytic signal.
+        \param Stage ... The count of stages inside an FFT algorithm. E.g. Stages = 4 -> sample count = 2^4
+        \param Radix ... The radix of the FFT algorithms.
+        \param Complex ... The complex data type.
+    */
+    template <typename Stage,
+              typename Radix,
+              typename Complex>
+    class HilbertTransform
+        : public ExecutableAlgorithm<Complex>
+    {
+        using ValueType = typename Complex::value_type;
+
+        /** Calculates the number of samples that can be processed by this algorithm.
+        */
+        static constexpr auto getNumberOfSamples(void)
+        {
+            if constexpr (hana::typeid_(Radix{}) == hana::type<jbo::Radix_4>{})
+                return std::integral_constant<int, 1 << (Stage::value << 1)>{};
+            else
+                return std::integral_constant<int, 1 << Stage::value>{};
+        }
+
+        using SampleCnt = typename decltype(getNumberOfSamples())::type;
+        using Backward = std::integral_constant<int, -1>;
+        using Forward = std::integral_constant<int, 1>;
+
+        /** Creates a tupel of sub task type values at compilation time.
+            \return hana::tuple_t ... A tuple of sub task type values.
+        */
+        static constexpr auto createTupleOfSubTaskTypeValues(void)
+        {
+            if constexpr (hana::typeid_(Radix{}) == hana::type<jbo::Radix_2>{})
+                return hana::tuple_t<
+                    core::Radix2DIF<SampleCnt, Backward, Complex>,
+                    AnalyticSignalMask<SampleCnt, Complex>,
+                    core::Radix2DIT<SampleCnt, Forward, Complex>>;
+            else if constexpr (hana::typeid_(Radix{}) == hana::type<jbo::Radix_4>{})
+                return hana::tuple_t<
+                    core::Radix4DIF<SampleCnt, Backward, Complex>,
+                    AnalyticSignalMask<SampleCnt, Complex>,
+                    core::Radix4DIT<SampleCnt, Forward, Complex>>;
+            else
+                return hana::tuple_t<
+                    core::RadixSplit24DIF<SampleCnt, Backward, Complex>,
+                    AnalyticSignalMask<SampleCnt, Complex>,
+                    core::RadixSplit24DIT<SampleCnt, Forward, Complex>>;
+        }
+
+        using SubTaskTypes = typename decltype(hana::unpack(createTupleOfSubTaskTypeValues(), hana::template_<hana::tuple>))::type;
+
+        SubTaskTypes tupleOfSubTasks_;
+
+    public:
+        /** Replaces the real parts in data by the analytic signal.
+            \param[in, out] data ... Pointer to an array of SampleCnt elements of type Complex. The imaginary parts have to be zero.
+        */
+        void operator()(Complex* data) const override
+        {
+            hana::for_each(tupleOfSubTasks_, [&](const auto& subTask)
+            {
+                subTask(data);
+            });
+        }
+
+        /** Calculates the analytic signal of real samples.
+            \param[in] input ... Pointer to an array of SampleCnt real samples.
+            \param[out] output ... Pointer to an array of SampleCnt elements of type Complex.
+        */
+        void operator()(const ValueType* input, Complex* output) const
+        {
+            tools::loadFrame(input, SampleCnt::value, output, SampleCnt::value);
+
+            operator()(output);
+        }
+
+        std::size_t numberOfSamples(void) const override
+        {
+            return SampleCnt::value;
+        }
+
+        std::size_t numberOfFrequencies(void) const override
+        {
+            return SampleCnt::value >> 1;
+        }
+    };
+
+    /** A factory for Hilbert transforms of different stage. Each stage is used for a certain count of data samples.
+        \param Begin ... The starting index of supported stages.
+        \param End ... The end index of supported stages.
+        \param Radix ... The radix of the FFT algorithms.
+        \param Complex ... The complex data type.
+    */
+    template <std::size_t Begin,
+              std::size_t End,
+              typename Radix,
+              typename Complex>
+    class HilbertTransformFactory
+    {
+        using Creator = std::unique_ptr<ExecutableAlgorithm<Complex>> (*)(void);
+
+        template <typename TransformType>
+        static std::unique_ptr<ExecutableAlgorithm<Complex>> createTransform(void)
+        {
+            return std::make_unique<TransformType>();
+        }
+
+        /** Creates a table of Hilbert transform creation functions indexed by stage - Begin at compilation time.
+            \return std::array ... The creation function of each stage.
+        */
+        static constexpr auto createCreatorTable(void)
+        {
+            return hana::unpack(hana::make_range(hana::int_c<Begin>, hana::int_c<End>), [](auto... stage)
+            {
+                return std::array<Creator, sizeof...(stage)>
+                {
+                    &createTransform<HilbertTransform<std::integral_constant<int, decltype(stage)::value>, Radix, Complex>>...
+                };
+            });
+        }
+
+        static constexpr auto creatorTable_ = createCreatorTable();
+
+    public:
+        /** Creates a pointer to a Hilbert transform instantiation.
+            \param[in] stage ... The stage of the Hilbert transform which is to be returned.
+            \return std::unique_ptr ... Pointer to the Hilbert transform instantiation.
+        */
+        std::unique_ptr<ExecutableAlgorithm<Complex>> getAlgorithm(const std::size_t stage) const
+        {
+            assert(stage >= Begin && stage < End && "Trying to find algorithm of unknown stage.");
+
+            return creatorTable_[stage - Begin]();
+        }
+    };
+}
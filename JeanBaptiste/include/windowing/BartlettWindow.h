@@ -3,6 +3,7 @@
 #include "../basic/Abs.h"
 #include "../basic/SineCosine.h"
 #include "ExecuteWindowOnComplexData.h"
+#include "WindowCorrectionFactors.h"
 #include <functional>
 #include <iostream>
 #include "../SubTask.h"
@@ -10,24 +11,34 @@
 namespace jeanbaptiste::windowing
 {
     template <typename SampleCnt,
-              typename Complex>
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
     class BartlettWindow
-        : public SubTask<BartlettWindow<SampleCnt, Complex>,
+        : public SubTask<BartlettWindow<SampleCnt, Complex, WindowInput>,
                          Complex>
     {
         using ValueType = typename Complex::value_type;
 
-        static constexpr ValueType createSample(const std::size_t index)
+    public:
+        /** Calculates a single sample of a Bartlett window of a sample count known at runtime only.
+            \param[in] index ... The index of the sample.
+            \param[in] sampleCnt ... The count of samples of the window.
+            \return ValueType ... The window sample.
+        */
+        static constexpr ValueType createSample(const std::size_t index, const std::size_t sampleCnt)
         {
-            return 1.0 - basic::abs<ValueType>(index - static_cast<ValueType>(kHalfSampleCnt_)) / kHalfSampleCnt_;
+            const unsigned halfSampleCnt = sampleCnt >> 1;
+
+            return 1.0 - basic::abs<ValueType>(index - static_cast<ValueType>(halfSampleCnt)) / halfSampleCnt;
         }
 
+    private:
         template<std::size_t... Indices>
         static constexpr auto createWindowSamples(std::index_sequence<Indices...>)
         {
             return std::array<ValueType, sizeof...(Indices)>
             {
-                createSample(Indices)...
+                createSample(Indices, SampleCnt::value)...
             };
         }
 
@@ -36,7 +47,6 @@ namespace jeanbaptiste::windowing
             return createWindowSamples(std::make_index_sequence<SampleCnt::value>{});
         }
 
-        static constexpr unsigned kHalfSampleCnt_ = SampleCnt::value >> 1;
         static constexpr auto windowSamples_ = getWindowSamples();
 
     public:
@@ -55,7 +65,21 @@ namespace jeanbaptiste::windowing
 		*/
         void operator()(Complex* data) const
         {
-            std::transform(data, data + SampleCnt::value, windowSamples_.begin(),data, ExecuteWindowOnComplexData<Complex>());
+            ExecuteWindowOnComplexData<Complex, WindowInput>{}(data, windowSamples_.data(), SampleCnt::value);
+        }
+
+        /** Returns the factor N / sum(w[n]) which corrects the amplitude of a windowed sinusoid.
+        */
+        static constexpr ValueType amplitudeCorrectionFactor(void)
+        {
+            return calculateAmplitudeCorrectionFactor(windowSamples_);
+        }
+
+        /** Returns the factor N / sum(w^2[n]) which corrects the power of a windowed signal.
+        */
+        static constexpr ValueType powerCorrectionFactor(void)
+        {
+            return calculatePowerCorrectionFactor(windowSamples_);
         }
     };
 }
\ No newline at end of file
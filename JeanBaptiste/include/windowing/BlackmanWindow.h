@@ -4,6 +4,7 @@
 #include "../basic/SineCosine.h"
 #include <boost/math/constants/constants.hpp>
 #include "ExecuteWindowOnComplexData.h"
+#include "WindowCorrectionFactors.h"
 #include <functional>
 #include <iostream>
 #include "../SubTask.h"
@@ -13,26 +14,37 @@ namespace constants = boost::math::constants;
 namespace jeanbaptiste::windowing
 {
     template <typename SampleCnt,
-              typename Complex>
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
     class BlackmanWindow
-        : public SubTask<BlackmanWindow<SampleCnt, Complex>,
+        : public SubTask<BlackmanWindow<SampleCnt, Complex, WindowInput>,
                          Complex>
     {
         using ValueType = typename Complex::value_type;
 
-        static constexpr ValueType createSample(const std::size_t index)
+    public:
+        /** Calculates a single sample of a Blackman window of a sample count known at runtime only.
+            \param[in] index ... The index of the sample.
+            \param[in] sampleCnt ... The count of samples of the window.
+            \return ValueType ... The window sample.
+        */
+        static constexpr ValueType createSample(const std::size_t index, const std::size_t sampleCnt)
         {
+            const double twoPiDividedBySampleCnt = 2.0 * constants::pi<double>() / sampleCnt;
+            const double fourPiDividedBySampleCnt = 2.0 * twoPiDividedBySampleCnt;
+
             return 0.42
-                 - 0.5  * jeanbaptiste::basic::cosine<double>(kTwoPiDividedBySampleCnt  * index)
-                 + 0.08 * jeanbaptiste::basic::cosine<double>(kFourPiDividedBySampleCnt * index);
+                 - 0.5  * jeanbaptiste::basic::cosine<double>(twoPiDividedBySampleCnt  * index)
+                 + 0.08 * jeanbaptiste::basic::cosine<double>(fourPiDividedBySampleCnt * index);
         }
 
+    private:
         template<std::size_t... Indices>
         static constexpr auto createWindowSamples(std::index_sequence<Indices...>)
         {
             return std::array<ValueType, sizeof...(Indices)>
             {
-                createSample(Indices)...
+                createSample(Indices, SampleCnt::value)...
             };
         }
 
@@ -41,8 +53,6 @@ namespace jeanbaptiste::windowing
             return createWindowSamples(std::make_index_sequence<SampleCnt::value>{});
         }
 
-        static constexpr double kTwoPiDividedBySampleCnt = 2.0 * constants::pi<double>() / SampleCnt::value;
-        static constexpr double kFourPiDividedBySampleCnt = 2.0 * kTwoPiDividedBySampleCnt;
         static constexpr auto windowSamples_ = getWindowSamples();
 
     public:
@@ -60,7 +70,21 @@ namespace jeanbaptiste::windowing
 		*/
         void operator()(Complex* data) const
         {
-            std::transform(data, data + SampleCnt::value, windowSamples_.begin(),data, ExecuteWindowOnComplexData<Complex>());
+            ExecuteWindowOnComplexData<Complex, WindowInput>{}(data, windowSamples_.data(), SampleCnt::value);
+        }
+
+        /** Returns the factor N / sum(w[n]) which corrects the amplitude of a windowed sinusoid.
+        */
+        static constexpr ValueType amplitudeCorrectionFactor(void)
+        {
+            return calculateAmplitudeCorrectionFactor(windowSamples_);
+        }
+
+        /** Returns the factor N / sum(w^2[n]) which corrects the power of a windowed signal.
+        */
+        static constexpr ValueType powerCorrectionFactor(void)
+        {
+            return calculatePowerCorrectionFactor(windowSamples_);
         }
     };
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "../basic/SineCosine.h"
 #include <boost/math/constants/constants.hpp>
 #include "ExecuteWindowOnComplexData.h"
+#include "WindowCorrectionFactors.h"
 #include <functional>
 #include <iostream>
 #include "../SubTask.h"
@@ -13,24 +14,34 @@ namespace constants = boost::math::constants;
 namespace jeanbaptiste::windowing
 {
     template <typename SampleCnt,
-              typename Complex>
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
     class CosineWindow
-        : public SubTask<CosineWindow<SampleCnt, Complex>,
+        : public SubTask<CosineWindow<SampleCnt, Complex, WindowInput>,
                          Complex>
     {
         using ValueType = typename Complex::value_type;
 
-        static constexpr ValueType createSample(const std::size_t index)
+    public:
+        /** Calculates a single sample of a Cosine window of a sample count known at runtime only.
+            \param[in] index ... The index of the sample.
+            \param[in] sampleCnt ... The count of samples of the window.
+            \return ValueType ... The window sample.
+        */
+        static constexpr ValueType createSample(const std::size_t index, const std::size_t sampleCnt)
         {
-            return jeanbaptiste::basic::cosine<double>(kPiDividedBySampleCnt  * index - constants::half_pi<double>());
+            const double piDividedBySampleCnt = constants::pi<double>() / sampleCnt;
+
+            return jeanbaptiste::basic::cosine<double>(piDividedBySampleCnt  * index - constants::half_pi<double>());
         }
 
+    private:
         template<std::size_t... Indices>
         static constexpr auto createWindowSamples(std::index_sequence<Indices...>)
         {
             return std::array<ValueType, sizeof...(Indices)>
             {
-                createSample(Indices)...
+                createSample(Indices, SampleCnt::value)...
             };
         }
 
@@ -39,7 +50,6 @@ namespace jeanbaptiste::windowing
             return createWindowSamples(std::make_index_sequence<SampleCnt::value>{});
         }
 
-        static constexpr double kPiDividedBySampleCnt = constants::pi<double>() / SampleCnt::value;
         static constexpr auto windowSamples_ = getWindowSamples();
 
     public:
@@ -57,7 +67,21 @@ namespace jeanbaptiste::windowing
 		*/
         void operator()(Complex* data) const
         {
-            std::transform(data, data + SampleCnt::value, windowSamples_.begin(),data, ExecuteWindowOnComplexData<Complex>());
+            ExecuteWindowOnComplexData<Complex, WindowInput>{}(data, windowSamples_.data(), SampleCnt::value);
+        }
+
+        /** Returns the factor N / sum(w[n]) which corrects the amplitude of a windowed sinusoid.
+        */
+        static constexpr ValueType amplitudeCorrectionFactor(void)
+        {
+            return calculateAmplitudeCorrectionFactor(windowSamples_);
+        }
+
+        /** Returns the factor N / sum(w^2[n]) which corrects the power of a windowed signal.
+        */
+        static constexpr ValueType powerCorrectionFactor(void)
+        {
+            return calculatePowerCorrectionFactor(windowSamples_);
         }
     };
 }
\ No newline at end of file
@@ -1,16 +1,143 @@
 #pragma once
 
+#include <complex>
+#include <cstddef>
+#include "../Options.h"
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define JEANBAPTISTE_WINDOW_USE_SSE2
+#endif
+
+namespace jbo = jeanbaptiste::options;
+
 namespace jeanbaptiste::windowing
 {
-    template <typename Complex>
+    /** Checks whether the window input conjugates the data while windowing it.
+    */
+    template <typename WindowInput>
+    struct IsWindowInputConjugated
+        : std::false_type
+    {};
+
+    template <typename WindowInput>
+    struct IsWindowInputConjugated<jbo::WindowInput_Conjugated<WindowInput>>
+        : std::true_type
+    {};
+
+    /** Removes the conjugation from a window input, e.g. WindowInput_Conjugated<WindowInput_Real> -> WindowInput_Real.
+    */
+    template <typename WindowInput>
+    struct RemoveWindowInputConjugation
+    {
+        using type = WindowInput;
+    };
+
+    template <typename WindowInput>
+    struct RemoveWindowInputConjugation<jbo::WindowInput_Conjugated<WindowInput>>
+    {
+        using type = WindowInput;
+    };
+
+    /** Applies window samples onto complex data.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines which parts of the complex data are scaled.
+                               WindowInput_Real: only the real part is scaled (real valued input stored in complex data).
+                               WindowInput_Complex: the real and the imaginary part are scaled (IQ data).
+                               WindowInput_Conjugated<...>: additionally conjugates the data in the same pass.
+    */
+    template <typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
     class ExecuteWindowOnComplexData
     {
         using ValueType = typename Complex::value_type;
 
+        static constexpr bool kScaleImaginary_ = std::is_same_v<typename RemoveWindowInputConjugation<WindowInput>::type,
+                                                                jbo::WindowInput_Complex>;
+        static constexpr bool kConjugate_ = IsWindowInputConjugated<WindowInput>::value;
+        static constexpr ValueType kImaginarySign_ = kConjugate_ ? -1 : 1;
+
+        /** Scalar kernel used for the remainder of the vectorized kernel and for complex types without SIMD support.
+            \param[in, out] data ... Pointer to an array of count elements of type Complex.
+            \param[in] window ... Pointer to an array of count window samples.
+            \param[in] begin ... Index of the first element to process.
+            \param[in] end ... Index behind the last element to process.
+        */
+        static void applyScalar(Complex* data, const ValueType* window, std::size_t begin, const std::size_t end)
+        {
+            for (; begin < end; ++begin)
+            {
+                if constexpr (kScaleImaginary_)
+                    data[begin] = Complex(data[begin].real() * window[begin], kImaginarySign_ * data[begin].imag() * window[begin]);
+                else
+                    data[begin] = Complex(data[begin].real() * window[begin], kImaginarySign_ * data[begin].imag());
+            }
+        }
+
     public:
-        Complex operator()(const Complex& factor1, const ValueType& factor2)
+        /** Applies a single window sample onto a single complex value.
+            \param[in] factor1 ... The complex value.
+            \param[in] factor2 ... The window sample.
+            \return Complex ... The windowed value.
+        */
+        Complex operator()(const Complex& factor1, const ValueType& factor2) const
         {
-            return Complex(factor1.real() * factor2, factor1.imag());
+            if constexpr (kScaleImaginary_)
+                return Complex(factor1.real() * factor2, kImaginarySign_ * factor1.imag() * factor2);
+            else
+                return Complex(factor1.real() * factor2, kImaginarySign_ * factor1.imag());
+        }
+
+        /** Applies count window samples onto count complex values in place.
+            std::complex<T> is layout compatible with T[2] which allows processing whole complex values per SIMD register:
+            one std::complex<double> or two std::complex<float> per 128 bit register.
+            \param[in, out] data ... Pointer to an array of count elements of type Complex.
+            \param[in] window ... Pointer to an array of count window samples.
+            \param[in] count ... The count of samples.
+        */
+        void operator()(Complex* data, const ValueType* window, const std::size_t count) const
+        {
+            std::size_t i = 0;
+
+#if defined(JEANBAPTISTE_WINDOW_USE_SSE2)
+            if constexpr (std::is_same_v<Complex, std::complex<double>>)
+            {
+                auto values = reinterpret_cast<double*>(data);
+                // (1, 1) or (1, -1) if conjugating.
+                const __m128d signs = _mm_set_pd(kImaginarySign_, 1.0);
+
+                for (; i < count; ++i)
+                {
+                    // Complex input: (w, w), real input: (w, 1). Conjugation negates the imaginary factor.
+                    const __m128d factor = kScaleImaginary_
+                        ? (kConjugate_ ? _mm_mul_pd(_mm_load1_pd(window + i), signs) : _mm_load1_pd(window + i))
+                        : _mm_move_sd(signs, _mm_load_sd(window + i));
+                    _mm_storeu_pd(values + 2 * i, _mm_mul_pd(_mm_loadu_pd(values + 2 * i), factor));
+                }
+            }
+            else if constexpr (std::is_same_v<Complex, std::complex<float>>)
+            {
+                auto values = reinterpret_cast<float*>(data);
+                const __m128 imaginarySigns = _mm_set1_ps(kImaginarySign_);
+                // (1, 1, 1, 1) or (1, -1, 1, -1) if conjugating.
+                const __m128 signs = _mm_unpacklo_ps(_mm_set1_ps(1.0f), imaginarySigns);
+
+                for (; i + 1 < count; i += 2)
+                {
+                    // Load two window samples into the lower half: (w0, w1, 0, 0). movlps needs no alignment, and __m64
+                    // may alias the floats.
+                    const __m128 samples = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(window + i));
+                    // Complex input: (w0, w0, w1, w1), real input: (w0, 1, w1, 1). Conjugation negates the imaginary factors.
+                    const __m128 factor = kScaleImaginary_
+                        ? (kConjugate_ ? _mm_mul_ps(_mm_unpacklo_ps(samples, samples), signs) : _mm_unpacklo_ps(samples, samples))
+                        : _mm_unpacklo_ps(samples, imaginarySigns);
+                    _mm_storeu_ps(values + 2 * i, _mm_mul_ps(_mm_loadu_ps(values + 2 * i), factor));
+                }
+            }
+#endif
+
+            applyScalar(data, window, i, count);
         }
     };
-}
\ No newline at end of file
+}
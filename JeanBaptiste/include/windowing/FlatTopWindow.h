@@ -4,6 +4,7 @@
 #include "../basic/SineCosine.h"
 #include <boost/math/constants/constants.hpp>
 #include "ExecuteWindowOnComplexData.h"
+#include "WindowCorrectionFactors.h"
 #include <functional>
 #include <iostream>
 #include "../SubTask.h"
@@ -13,29 +14,42 @@ namespace constants = boost::math::constants;
 namespace jeanbaptiste::windowing
 {
     template <typename SampleCnt,
-              typename Complex>
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
     class FlatTopWindow
-        : public SubTask<FlatTopWindow<SampleCnt, Complex>,
+        : public SubTask<FlatTopWindow<SampleCnt, Complex, WindowInput>,
                          Complex>
     {
         using ValueType = typename Complex::value_type;
 
-        static constexpr ValueType createSample(const std::size_t index)
+    public:
+        /** Calculates a single sample of a FlatTop window of a sample count known at runtime only.
+            \param[in] index ... The index of the sample.
+            \param[in] sampleCnt ... The count of samples of the window.
+            \return ValueType ... The window sample.
+        */
+        static constexpr ValueType createSample(const std::size_t index, const std::size_t sampleCnt)
         {
+            const double twoPiDividedBySampleCnt = 2.0 * constants::pi<double>() / sampleCnt;
+            const double fourPiDividedBySampleCnt = 2.0 * twoPiDividedBySampleCnt;
+            const double sixPiDividedBySampleCnt = 3.0 * twoPiDividedBySampleCnt;
+            const double eightPiDividedBySampleCnt = 4.0 * twoPiDividedBySampleCnt;
+
             return 1.0
-                 - 1.93  * jeanbaptiste::basic::cosine<double>(kTwoPiDividedBySampleCnt   * index)
-                 + 1.29  * jeanbaptiste::basic::cosine<double>(kFourPiDividedBySampleCnt  * index)
-                 - 0.388 * jeanbaptiste::basic::cosine<double>(kSixPiDividedBySampleCnt   * index)
-                 + 0.028 * jeanbaptiste::basic::cosine<double>(kEightPiDividedBySampleCnt * index)
+                 - 1.93  * jeanbaptiste::basic::cosine<double>(twoPiDividedBySampleCnt   * index)
+                 + 1.29  * jeanbaptiste::basic::cosine<double>(fourPiDividedBySampleCnt  * index)
+                 - 0.388 * jeanbaptiste::basic::cosine<double>(sixPiDividedBySampleCnt   * index)
+                 + 0.028 * jeanbaptiste::basic::cosine<double>(eightPiDividedBySampleCnt * index)
                  ;
         }
 
+    private:
         template<std::size_t... Indices>
         static constexpr auto createWindowSamples(std::index_sequence<Indices...>)
         {
             return std::array<ValueType, sizeof...(Indices)>
             {
-                createSample(Indices)...
+                createSample(Indices, SampleCnt::value)...
             };
         }
 
@@ -44,10 +58,6 @@ namespace jeanbaptiste::windowing
             return createWindowSamples(std::make_index_sequence<SampleCnt::value>{});
         }
 
-        static constexpr double kTwoPiDividedBySampleCnt   = 2.0 * constants::pi<double>() / SampleCnt::value;
-        static constexpr double kFourPiDividedBySampleCnt  = 2.0 * kTwoPiDividedBySampleCnt;
-        static constexpr double kSixPiDividedBySampleCnt   = 3.0 * kTwoPiDividedBySampleCnt;
-        static constexpr double kEightPiDividedBySampleCnt = 4.0 * kTwoPiDividedBySampleCnt;
         static constexpr auto windowSamples_ = getWindowSamples();
 
     public:
@@ -67,7 +77,21 @@ namespace jeanbaptiste::windowing
 		*/
         void operator()(Complex* data) const
         {
-            std::transform(data, data + SampleCnt::value, windowSamples_.begin(),data, ExecuteWindowOnComplexData<Complex>());
+            ExecuteWindowOnComplexData<Complex, WindowInput>{}(data, windowSamples_.data(), SampleCnt::value);
+        }
+
+        /** Returns the factor N / sum(w[n]) which corrects the amplitude of a windowed sinusoid.
+        */
+        static constexpr ValueType amplitudeCorrectionFactor(void)
+        {
+            return calculateAmplitudeCorrectionFactor(windowSamples_);
+        }
+
+        /** Returns the factor N / sum(w^2[n]) which corrects the power of a windowed signal.
+        */
+        static constexpr ValueType powerCorrectionFactor(void)
+        {
+            return calculatePowerCorrectionFactor(windowSamples_);
         }
     };
 }
\ No newline at end of file
@@ -1,21 +1,55 @@
  #pragma once
 
+#include <complex>
+#include "ExecuteWindowOnComplexData.h"
+#include "../Options.h"
 #include "../SubTask.h"
 
+namespace jbo = jeanbaptiste::options;
+
 namespace jeanbaptiste::windowing
 {
     /** Creates an empty window (rectangular) for a specified sample count.
         \param SampleCnt ... The count of samples to be processed in this recursion level (stage)
         \param Complex ... The complex type.
+        \param WindowInput ... Defines which parts of the complex data would be windowed.
     */
     template <typename SampleCnt,
-              typename Complex>
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
     class NoWindow
-        : public SubTask<NoWindow<SampleCnt, Complex>,
+        : public SubTask<NoWindow<SampleCnt, Complex, WindowInput>,
                          Complex>
     {
     public:
+        /** Does nothing, unless the window input is conjugated. Then each element of data is conjugated.
+            \param[in, out] data ... Pointer to an array of SampleCnt elements of type Complex.
+        */
         void operator()(Complex* data) const
-        {}
+        {
+            if constexpr (IsWindowInputConjugated<WindowInput>::value)
+            {
+                for (std::size_t i = 0; i < SampleCnt::value; ++i)
+                    data[i] = std::conj(data[i]);
+            }
+        }
+
+        /** Returns the sample 1 of a rectangular window of any sample count.
+        */
+        static constexpr typename Complex::value_type createSample(const std::size_t /*index*/,
+            const std::size_t /*sampleCnt*/)
+        {
+            return 1;
+        }
+
+        static constexpr typename Complex::value_type amplitudeCorrectionFactor(void)
+        {
+            return 1;
+        }
+
+        static constexpr typename Complex::value_type powerCorrectionFactor(void)
+        {
+            return 1;
+        }
     };
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "../basic/Abs.h"
 #include "../basic/SineCosine.h"
 #include "ExecuteWindowOnComplexData.h"
+#include "WindowCorrectionFactors.h"
 #include <functional>
 #include <iostream>
 #include "../SubTask.h"
@@ -10,29 +11,40 @@
 namespace jeanbaptiste::windowing
 {
     template <typename SampleCnt,
-              typename Complex>
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
     class WelchWindow
-        : public SubTask<WelchWindow<SampleCnt, Complex>,
+        : public SubTask<WelchWindow<SampleCnt, Complex, WindowInput>,
                          Complex>
     {
         using ValueType = typename Complex::value_type;
 
-        static constexpr ValueType createSample(const std::size_t index)
+    public:
+        /** Calculates a single sample of a Welch window of a sample count known at runtime only.
+            \param[in] index ... The index of the sample.
+            \param[in] sampleCnt ... The count of samples of the window.
+            \return ValueType ... The window sample.
+        */
+        static constexpr ValueType createSample(const std::size_t index, const std::size_t sampleCnt)
         {
-            auto temp = [&index]() constexpr
+            const double halfSampleCntMinusOne = (sampleCnt - 1) / 2.0;
+            const double halfSampleCntPlusOneReciprocal = 1.0 / ((sampleCnt + 1) / 2.0);
+
+            auto temp = [&]() constexpr
             {
-                return (index - kHalfSampleCntMinusOne_) * kHalfSampleCntPlusOneReciprocal_;
+                return (index - halfSampleCntMinusOne) * halfSampleCntPlusOneReciprocal;
             };
 
             return 1.0 - temp() * temp();
         }
 
+    private:
         template<std::size_t... Indices>
         static constexpr auto createWindowSamples(std::index_sequence<Indices...>)
         {
             return std::array<ValueType, sizeof...(Indices)>
             {
-                createSample(Indices)...
+                createSample(Indices, SampleCnt::value)...
             };
         }
 
@@ -41,8 +53,6 @@ namespace jeanbaptiste::windowing
             return createWindowSamples(std::make_index_sequence<SampleCnt::value>{});
         }
 
-        static constexpr double kHalfSampleCntMinusOne_ = (SampleCnt::value - 1) / 2.0;
-        static constexpr double kHalfSampleCntPlusOneReciprocal_ = 1.0 / ((SampleCnt::value + 1) / 2.0);
         static constexpr auto windowSamples_ = getWindowSamples();
 
     public:
@@ -60,7 +70,21 @@ namespace jeanbaptiste::windowing
 		*/
         void operator()(Complex* data) const
         {
-            std::transform(data, data + SampleCnt::value, windowSamples_.begin(),data, ExecuteWindowOnComplexData<Complex>());
+            ExecuteWindowOnComplexData<Complex, WindowInput>{}(data, windowSamples_.data(), SampleCnt::value);
+        }
+
+        /** Returns the factor N / sum(w[n]) which corrects the amplitude of a windowed sinusoid.
+        */
+        static constexpr ValueType amplitudeCorrectionFactor(void)
+        {
+            return calculateAmplitudeCorrectionFactor(windowSamples_);
+        }
+
+        /** Returns the factor N / sum(w^2[n]) which corrects the power of a windowed signal.
+        */
+        static constexpr ValueType powerCorrectionFactor(void)
+        {
+            return calculatePowerCorrectionFactor(windowSamples_);
         }
     };
 }
\ No newline at end of file
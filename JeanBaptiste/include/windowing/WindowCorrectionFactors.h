@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace jeanbaptiste::windowing
+{
+    /** Calculates the factor N / sum(w[n]) which corrects the amplitude of a windowed sinusoid (inverse coherent gain).
+        \param[in] samples ... The window samples.
+        \return ValueType ... The amplitude correction factor.
+    */
+    template <typename ValueType,
+              std::size_t SampleCnt>
+    constexpr ValueType calculateAmplitudeCorrectionFactor(const std::array<ValueType, SampleCnt>& samples)
+    {
+        ValueType sum{};
+        for (std::size_t i = 0; i < SampleCnt; ++i)
+            sum += samples[i];
+
+        return SampleCnt / sum;
+    }
+
+    /** Calculates the factor N / sum(w^2[n]) which corrects the power of a windowed signal (inverse incoherent power gain).
+        \param[in] samples ... The window samples.
+        \return ValueType ... The power correction factor.
+    */
+    template <typename ValueType,
+              std::size_t SampleCnt>
+    constexpr ValueType calculatePowerCorrectionFactor(const std::array<ValueType, SampleCnt>& samples)
+    {
+        ValueType sum{};
+        for (std::size_t i = 0; i < SampleCnt; ++i)
+            sum += samples[i] * samples[i];
+
+        return SampleCnt / sum;
+    }
+
+    /** Calculates the factor N / sum(w^2[n]) of window samples created at runtime, see createWindowSamples().
+        \param[in] samples ... The window samples.
+        \return ValueType ... The power correction factor.
+    */
+    template <typename ValueType>
+    ValueType calculatePowerCorrectionFactor(const std::vector<ValueType>& samples)
+    {
+        ValueType sum{};
+        for (const auto sample : samples)
+            sum += sample * sample;
+
+        return samples.size() / sum;
+    }
+}
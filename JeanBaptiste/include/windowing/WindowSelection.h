@@ -0,0 +1,77 @@
+#pragma once
+
+#include <boost/hana.hpp>
+#include <complex>
+#include "../Options.h"
+#include <type_traits>
+#include <vector>
+#include "BartlettWindow.h"
+#include "BlackmanHarrisWindow.h"
+#include "BlackmanWindow.h"
+#include "CosineWindow.h"
+#include "FlatTopWindow.h"
+#include "HammingWindow.h"
+#include "NoWindow.h"
+#include "VonHannWindow.h"
+#include "WelchWindow.h"
+
+namespace hana = boost::hana;
+namespace jbo = jeanbaptiste::options;
+
+namespace jeanbaptiste::windowing
+{
+    /** Creates a value of the window sub task type selected by a window option at compilation time.
+        \param Window ... The window option, e.g. Window_Bartlett.
+        \param SampleCnt ... The count of samples to be windowed.
+        \param Complex ... The complex data type.
+        \param WindowInput ... Defines whether the window scales the real part only or the real and the imaginary part.
+        \return value ... The selected value.
+    */
+    template <typename Window,
+              typename SampleCnt,
+              typename Complex,
+              typename WindowInput = jbo::WindowInput_Real>
+    constexpr auto selectWindow(void)
+    {
+        return
+            hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Bartlett>{},
+                BartlettWindow<SampleCnt, Complex, WindowInput>{},
+            hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Blackman>{},
+                BlackmanWindow<SampleCnt, Complex, WindowInput>{},
+            hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_BlackmanHarris>{},
+                BlackmanHarrisWindow<SampleCnt, Complex, WindowInput>{},
+            hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Cosine>{},
+                CosineWindow<SampleCnt, Complex, WindowInput>{},
+            hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_FlatTop>{},
+                FlatTopWindow<SampleCnt, Complex, WindowInput>{},
+            hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Hamming>{},
+                HammingWindow<SampleCnt, Complex, WindowInput>{},
+            hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_vonHann>{},
+                VonHannWindow<SampleCnt, Complex, WindowInput>{},
+            hana::if_(hana::typeid_(Window{}) == hana::type<jbo::Window_Welch>{},
+                WelchWindow<SampleCnt, Complex, WindowInput>{},
+                NoWindow<SampleCnt, Complex, WindowInput>{}
+            ))))))));
+    }
+
+    /** Creates the samples of the window that an algorithm windowing sampleCnt samples applies, e.g. 4^stage samples of a
+        radix 4 algorithm. The samples are calculated by the same formula the window tables are created with.
+        \param Window ... The window option, e.g. Window_Bartlett.
+        \param Complex ... The complex data type.
+        \param[in] sampleCnt ... The count of samples of the window.
+        \return std::vector ... The window samples.
+    */
+    template <typename Window,
+              typename Complex>
+    std::vector<typename Complex::value_type> createWindowSamples(const std::size_t sampleCnt)
+    {
+        // The formula does not depend on the sample count the window type is instantiated with.
+        using WindowType = decltype(selectWindow<Window, std::integral_constant<int, 2>, Complex>());
+
+        std::vector<typename Complex::value_type> samples(sampleCnt);
+        for (std::size_t i = 0; i < sampleCnt; ++i)
+            samples[i] = WindowType::createSample(i, sampleCnt);
+
+        return samples;
+    }
+}
@@ -0,0 +1,54 @@
+#include <cmath>
+#include <complex>
+#include "../include/AlgorithmFactory.h"
+#include <iostream>
+#include <vector>
+
+namespace jb = jeanbaptiste;
+namespace jbo = jeanbaptiste::options;
+
+/** Built with JEANBAPTISTE_EXTERN_TEMPLATES: all algorithms of the factories below are taken from the library
+    jeanbaptiste_instantiations. Runs a forward and a backward transform of each stage and checks the round trip.
+*/
+template <typename Radix, std::size_t End, typename Complex>
+bool checkRoundTrip(void)
+{
+    jb::AlgorithmFactory<1, End, Radix, jbo::Decimation_In_Time, jbo::Direction_Forward, jbo::Window_None,
+        jbo::Normalization_No, Complex> forwardFactory;
+    jb::AlgorithmFactory<1, End, Radix, jbo::Decimation_In_Time, jbo::Direction_Backward, jbo::Window_None,
+        jbo::Normalization_Division_By_Length, Complex> backwardFactory;
+
+    for (std::size_t stage = 1; stage < End; ++stage)
+    {
+        auto forward = forwardFactory.getAlgorithm(stage);
+        auto backward = backwardFactory.getAlgorithm(stage);
+
+        std::vector<Complex> data(forward->numberOfSamples());
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = Complex(std::sin(0.3 * i), 0.25 * std::sin(2.1 * i));
+        auto signal = data;
+
+        (*forward)(&data[0]);
+        (*backward)(&data[0]);
+
+        for (std::size_t i = 0; i < data.size(); ++i)
+            if (std::abs(data[i] - signal[i]) > 0.001)
+                return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    const bool passed = checkRoundTrip<jbo::Radix_2, 13, std::complex<double>>()
+        && checkRoundTrip<jbo::Radix_2, 13, std::complex<float>>()
+        && checkRoundTrip<jbo::Radix_Split_2_4, 13, std::complex<double>>()
+        && checkRoundTrip<jbo::Radix_Split_2_4, 13, std::complex<float>>()
+        && checkRoundTrip<jbo::Radix_4, 7, std::complex<double>>()
+        && checkRoundTrip<jbo::Radix_4, 7, std::complex<float>>();
+
+    std::cout << (passed ? "All extern algorithms passed.\n" : "An extern algorithm failed.\n");
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,3 @@
+#include "../../include/AlgorithmInstantiation.h"
+
+JEANBAPTISTE_INSTANTIATE_RADIX_2_CONFIGURATIONS(, Radix_2, std::complex<double>)
@@ -0,0 +1,3 @@
+#include "../../include/AlgorithmInstantiation.h"
+
+JEANBAPTISTE_INSTANTIATE_RADIX_4_CONFIGURATIONS(, std::complex<float>)